@@ -1,12 +1,16 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <optional>
 #include "app/MenuScreen.hpp"
 #include "app/CreditsScreen.hpp"
 #include "app/HowToPlayScreen.hpp"
+#include "app/LoadingScreen.hpp"
 #include "app/GameScreen.hpp"
 #include "app/Screen.hpp"
 #include "app/TitleScreen.hpp"
+#include "ui/AssetLoader.hpp"
+#include "ui/ProfilerOverlay.hpp"
 
 namespace App
 {
@@ -20,18 +24,38 @@ namespace App
         void run();
 
     private:
+        // Queue the images and sounds decoded while the loading screen shows.
+        void queueStartupAssets();
+        // Initialize the screens once assets are cached and show the title screen.
+        void finishStartup();
+        // Sleep until input or the active screen's next wake-up when its frame is current.
+        void waitForActivity();
         // Pump OS/window events and forward to the active screen.
         void processEvents();
+        // Route one window event to the window or the active screen.
+        void dispatchEvent(const sf::Event &event);
         // Advance the active screen simulation for the current frame.
         void update();
-        // Draw the active screen to the window.
-        void render();
+        // Draw the active screen to the window; false when nothing was presented.
+        bool render();
+        // Write the recorded profile as CSV and Chrome trace JSON.
+        void exportProfile();
         // Switch active screen and run enter/exit hooks.
         void setCurrentScreen(Screen *screen);
 
+        // Folders whose PNGs are decoded at startup (tutorial boards load with their screen).
+        static constexpr const char *STARTUP_IMAGE_DIRECTORIES[] = {"assets/textures", "assets/ui"};
+        // Longest idle sleep when the screen scheduled no wake-up.
+        static constexpr float MAX_IDLE_WAIT = 1.f;
+
     private:
         sf::RenderWindow m_window;
         sf::Clock m_clock;
+        // Event that ended the idle wait, dispatched with the next frame.
+        std::optional<sf::Event> m_pendingEvent;
+        UI::ProfilerOverlay m_profilerOverlay;
+        UI::AssetLoader m_assetLoader;
+        std::unique_ptr<LoadingScreen> m_loadingScreen;
         std::unique_ptr<TitleScreen> m_titleScreen;
         std::unique_ptr<MenuScreen> m_menuScreen;
         std::unique_ptr<CreditsScreen> m_creditsScreen;
@@ -1,11 +1,15 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <future>
+#include <string>
+#include <vector>
 #include "heuristic/HeuristicEngine.hpp"
 #include "app/Screen.hpp"
 #include "game/Board.hpp"
+#include "game/GameRecord.hpp"
 #include "game/GameState.hpp"
 #include "ui/GameRenderer.hpp"
 #include "ui/Hud.hpp"
@@ -19,6 +23,10 @@ namespace App
     {
     public:
         static constexpr const char *MUSIC_PATH = "assets/sound/game_theme.mp3";
+        static constexpr const char *RECORD_DIR_ENV = "QUORIDOR_RECORD_DIR"; // Set to save game records #
+        static constexpr int CPU_CLOCK_MS = 120000; // CPU thinking time per game #
+        static constexpr int CPU_INCREMENT_MS = 2000; // Added to the CPU clock after each of its moves #
+        static constexpr float CPU_POLL_INTERVAL = 0.02f; // Seconds between checks for the CPU move #
 
         enum class GameMode
         {
@@ -26,6 +34,8 @@ namespace App
             Multiplayer
         };
 
+        ~GameScreen() override; // Stop a running CPU search #
+
         bool init() override; // Init gameplay and UI #
         void setGameMode(GameMode mode); // Set game mode #
         void setOnQuit(std::function<void()> onQuit); // Register quit callback #
@@ -34,6 +44,7 @@ namespace App
         void handleResize(sf::RenderWindow &window, sf::Vector2u size) override; // Reflow views #
         void update(float dt) override; // Update game loop #
         void render(sf::RenderWindow &window) override; // Draw gameplay #
+        const char *name() const override { return "Game"; } // Profiler label #
         void onEnter() override; // Enter screen #
         void onExit() override; // Exit screen #
 
@@ -47,9 +58,14 @@ namespace App
         void toggleWallMode(); // Toggle wall mode #
         void rotateWall(); // Rotate wall orientation #
         void checkWinCondition(int playerId); // Check winner #
+        bool syncBoard(const Game::Move &move); // Update board view after a move #
         void runHeuristicTurn(); // Schedule CPU turn #
         void resetUIState(); // Reset UI flags #
         void updateHeuristicTurn(); // Update CPU turn #
+        void cancelCpuSearch(); // Stop the CPU search and wait until it no longer touches the engine #
+        void startGameRecord(); // Begin a new move list and position history #
+        void recordMove(const Game::Move &move, const Game::HeuristicSearchInfo *info); // Log a ply and its position #
+        void saveGameRecord(); // Write the move list once #
 
         Game::Board m_board;
         Game::GameState m_gameState;
@@ -60,6 +76,10 @@ namespace App
         Game::HeuristicEngine m_heuristicEngine;
         UI::WinnerMenu m_winnerMenu;
         std::function<void()> m_onQuit;
+        Game::GameRecord m_record;
+        std::string m_recordDirectory;
+        bool m_recordSaved = false;
+        std::vector<Game::ZobristKeys> m_positionHistory; // Positions since the last wall, for repetition checks #
 
         GameMode m_gameMode = GameMode::SinglePlayer;
         bool m_isPlacingWall = false;
@@ -68,8 +88,10 @@ namespace App
         bool m_winSfxPlayed = false;
         bool m_cpuPending = false;
         bool m_cpuThinking = false;
+        int m_cpuClockMs = CPU_CLOCK_MS; // Time left on the CPU game clock #
         uint64_t m_stateVersion = 0;
         uint64_t m_cpuStateVersion = 0;
         std::future<Game::Move> m_cpuFuture;
+        std::atomic<bool> m_cpuStop{false}; // Stop flag handed to the engine #
     };
 }
@@ -1,9 +1,13 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <functional>
+#include <future>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "app/Screen.hpp"
+#include "ui/ResourceCache.hpp"
 
 namespace App
 {
@@ -33,14 +37,20 @@ namespace App
         void handleResize(sf::RenderWindow &window, sf::Vector2u size) override; // Reflow layout #
         void update(float dt) override; // Update timers #
         void render(sf::RenderWindow &window) override; // Draw screen #
+        const char *name() const override { return "HowToPlay"; } // Profiler label #
         void onEnter() override; // Enter screen #
+        void onExit() override; // Release board textures #
 
     private:
         const char *getMusicPath() const override { return MUSIC_PATH; } // Music path #
         void updateLayout(const sf::View &view); // Scale/position elements #
         void applyStep(std::size_t index); // Apply step #
         void advanceStep(); // Next step #
-        bool loadBoardImage(const std::string &path); // Load board image #
+        void showBoardImage(const std::string &path); // Swap in a board image, or wait for its decode #
+        void requestBoardImage(const std::string &path); // Start decoding a board image off the UI thread #
+        void prefetchBoardImages(); // Decode the next steps' distinct board images #
+        void collectBoardImages(); // Upload finished decodes #
+        void layoutBoardSprite(); // Fit the board sprite into its rect #
         void updateDialogueText(); // Update dialogue text #
         sf::FloatRect computeBoardRect(const sf::View &view) const; // Board rect #
         sf::FloatRect computeDialogueRect(const sf::View &view) const; // Dialogue rect #
@@ -51,19 +61,22 @@ namespace App
                                     float maxWidth); // Wrap text #
         static std::vector<TutorialStep> loadTutorialStepsFromFile(const std::string &path); // Load steps #
 
-        sf::Texture m_knightBackgroundTexture;
-        sf::Texture m_wizardBackgroundTexture;
+        UI::ResourceHandle<sf::Texture> m_knightBackgroundTexture;
+        UI::ResourceHandle<sf::Texture> m_wizardBackgroundTexture;
         sf::Sprite m_backgroundSprite;
-        sf::Texture m_boardTexture;
         sf::Sprite m_boardSprite;
-        sf::Font m_font;
+        UI::ResourceHandle<sf::Font> m_font;
         sf::Text m_dialogueText;
         sf::Text m_speakerNameText;
         sf::Text m_speakerNameShadow;
         sf::ConvexShape m_continueIndicator;
         std::vector<TutorialStep> m_steps;
         std::size_t m_currentStep = 0;
-        std::string m_loadedBoardPath;
+        // Board images by path: uploaded ones are reused across steps, pending ones decode on worker threads.
+        static constexpr std::size_t PREFETCH_IMAGES = 2; // Distinct upcoming images decoded ahead #
+        std::unordered_map<std::string, UI::ResourceHandle<sf::Texture>> m_boardTextures; // Null marks a failed load #
+        std::unordered_map<std::string, std::future<std::shared_ptr<sf::Image>>> m_pendingBoards;
+        std::string m_boardPath; // Image the current step shows #
         bool m_hasBoardImage = false;
         bool m_hasFont = false;
         std::function<void()> m_onBack;
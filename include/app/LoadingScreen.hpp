@@ -0,0 +1,38 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include "app/Screen.hpp"
+#include "ui/AssetLoader.hpp"
+#include "ui/ResourceCache.hpp"
+
+namespace App
+{
+    class LoadingScreen : public Screen
+    {
+    public:
+        explicit LoadingScreen(UI::AssetLoader &loader); // Build screen state around a running loader #
+        bool init() override; // Load the font #
+        void setOnFinished(std::function<void()> onFinished); // Register completion callback #
+
+        void handleEvent(const sf::Event &event, sf::RenderWindow &window) override; // Ignore input #
+        void handleResize(sf::RenderWindow &window, sf::Vector2u size) override; // Reflow layout #
+        void update(float dt) override; // Collect decoded assets #
+        void render(sf::RenderWindow &window) override; // Draw progress #
+        const char *name() const override { return "Loading"; } // Profiler label #
+
+    private:
+        void updateProgressBar(); // Resize the fill to the collected share #
+
+        static constexpr float POLL_INTERVAL = 1.f / 30.f; // Seconds between collects #
+        static constexpr sf::Vector2f BAR_SIZE{640.f, 24.f};
+
+        UI::AssetLoader &m_loader;
+        UI::ResourceHandle<sf::Font> m_font;
+        sf::Text m_label;
+        sf::RectangleShape m_barFrame;
+        sf::RectangleShape m_barFill;
+        sf::View m_view;
+        std::function<void()> m_onFinished;
+        bool m_finished = false;
+    };
+}
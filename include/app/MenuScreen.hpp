@@ -3,6 +3,7 @@
 #include <functional>
 #include <vector>
 #include "app/Screen.hpp"
+#include "ui/ResourceCache.hpp"
 
 namespace App
 {
@@ -27,6 +28,7 @@ namespace App
         void handleResize(sf::RenderWindow &window, sf::Vector2u size) override; // Reflow layout #
         void update(float dt) override; // Update timers #
         void render(sf::RenderWindow &window) override; // Draw screen #
+        const char *name() const override { return "Menu"; } // Profiler label #
 
     private:
         const char *getMusicPath() const override { return MUSIC_PATH; } // Music path #
@@ -43,9 +45,9 @@ namespace App
         static constexpr int FRAME_HEIGHT = 450;
         static constexpr float FRAME_TIME = 1.f / 24.f;
 
-        sf::Texture m_backgroundTexture;
+        UI::ResourceHandle<sf::Texture> m_backgroundTexture;
         sf::Sprite m_backgroundSprite;
-        sf::Font m_font;
+        UI::ResourceHandle<sf::Font> m_font;
         std::vector<sf::Text> m_optionTexts;
         std::vector<Option> m_options;
         sf::VertexArray m_menuGradient;
@@ -18,19 +18,39 @@ namespace App
         virtual void update(float dt) = 0;
         // Render the screen content.
         virtual void render(sf::RenderWindow &window) = 0;
+        // Short label used by the frame profiler.
+        virtual const char *name() const { return "Screen"; }
 
         // Called when the screen becomes active.
         virtual void onEnter();
         // Called when the screen is deactivated.
         virtual void onExit();
 
+        // Run update() with a fresh wake request; the loop calls this instead of update().
+        void tick(float dt);
+        // Request a redraw on the next loop pass.
+        void invalidate();
+        // True when the last presented frame is stale.
+        bool needsRedraw() const { return m_needsRedraw; }
+        // Clear the redraw request once the frame is presented.
+        void markDrawn() { m_needsRedraw = false; }
+        // Seconds until the screen wants update() again; negative waits for input only.
+        float wakeDelay() const { return m_wakeDelay; }
+
         // Default music volume for screens.
         static constexpr float DEFAULT_MUSIC_VOLUME = 40.f;
 
     protected:
+        // Ask for update() after a delay (animation frames, polling); the earliest request wins.
+        void scheduleWake(float seconds);
+
         // Override to provide a background music path.
         virtual const char *getMusicPath() const { return nullptr; }
         // Restart the current screen music from the beginning.
         void restartMusic();
+
+    private:
+        bool m_needsRedraw = true;
+        float m_wakeDelay = -1.f;
     };
 }
@@ -2,6 +2,7 @@
 #include <SFML/Graphics.hpp>
 #include <functional>
 #include "app/Screen.hpp"
+#include "ui/ResourceCache.hpp"
 
 namespace App
 {
@@ -18,6 +19,7 @@ namespace App
         void handleResize(sf::RenderWindow &window, sf::Vector2u size) override; // Reflow layout #
         void update(float dt) override; // Update timers #
         void render(sf::RenderWindow &window) override; // Draw screen #
+        const char *name() const override { return "Title"; } // Profiler label #
 
     private:
         const char *getMusicPath() const override { return MUSIC_PATH; } // Music path #
@@ -30,9 +32,9 @@ namespace App
         static constexpr int FRAME_HEIGHT = 450;
         static constexpr float FRAME_TIME = 1.f / 24.f;
 
-        sf::Texture m_backgroundTexture;
+        UI::ResourceHandle<sf::Texture> m_backgroundTexture;
         sf::Sprite m_backgroundSprite;
-        sf::Font m_font;
+        UI::ResourceHandle<sf::Font> m_font;
         sf::Text m_promptLine1;
         sf::Text m_promptLine2;
         sf::VertexArray m_promptGradient;
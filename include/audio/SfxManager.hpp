@@ -2,6 +2,7 @@
 #include <SFML/Audio.hpp>
 #include <array>
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -28,6 +29,8 @@ namespace Audio
         void play(SfxId id); // Play a sound effect by id.
         
         void preloadAll(); // Preload all sound buffers.
+
+        std::vector<std::string> assetPaths() const; // Distinct sound files, for background decoding.
         
         void setSfxVolume(float volume); // Set the master SFX volume (0-100).
         
@@ -45,19 +48,27 @@ namespace Audio
         
         float volumeFromScale(float scale) const; // Convert a scale factor to a clamped volume.
         
-        sf::Sound &acquireSound(const sf::SoundBuffer &buffer, float volumeScale); // Acquire a sound from the pool or rotate when full.
+        sf::Sound &acquireSound(const sf::SoundBuffer &buffer, float volumeScale); // Take a free voice, grow the pool, or steal the one ending first.
+        
+        void reclaimFinished(double now); // Return voices whose sound has ended to the free list.
+        
+        void pushBusy(std::size_t voice); // Add a voice to the busy heap.
+        
+        std::size_t popBusy(); // Remove and return the busy voice that ends first.
         
         void applyVolume(); // Apply current volume settings to the pool.
 
         static constexpr std::size_t kMaxPool = 16;
         std::array<std::string, static_cast<std::size_t>(SfxId::Count)> m_paths;
-        std::array<sf::SoundBuffer, static_cast<std::size_t>(SfxId::Count)> m_buffers;
-        std::array<bool, static_cast<std::size_t>(SfxId::Count)> m_loaded{};
+        std::array<std::shared_ptr<const sf::SoundBuffer>, static_cast<std::size_t>(SfxId::Count)> m_buffers; // Shared via UI::ResourceCache
         std::array<bool, static_cast<std::size_t>(SfxId::Count)> m_failed{};
         std::array<float, static_cast<std::size_t>(SfxId::Count)> m_volumeScales{};
         std::vector<sf::Sound> m_pool;
         std::vector<float> m_poolScales;
-        std::size_t m_nextIndex = 0;
+        std::vector<double> m_voiceEnds; // Expected end of each voice, in seconds on m_clock
+        std::vector<std::size_t> m_freeVoices; // Voices known to be silent, used as a stack
+        std::vector<std::size_t> m_busyVoices; // Playing voices, min-heap on m_voiceEnds
+        sf::Clock m_clock;
         float m_volume = 70.f;
         bool m_muted = false;
     };
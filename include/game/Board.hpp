@@ -2,14 +2,17 @@
 #include "game/Field.hpp"
 #include "game/Wall.hpp"
 #include "game/Pawn.hpp"
+#include "ui/ResourceCache.hpp"
 #include <SFML/Graphics.hpp>
 #include <array>
+#include <cstdint>
 #include <vector>
 #include <optional>
 
 namespace Game
 {
     struct GameState;
+    class Move;
 
     class Board
     {
@@ -20,9 +23,10 @@ namespace Game
         std::vector<Field> m_fields;
         std::vector<Wall> m_walls;
         std::vector<Pawn> m_pawns;
-        sf::Texture m_backgroundTexture;
+        UI::ResourceHandle<sf::Texture> m_backgroundTexture;
         sf::Sprite m_backgroundSprite;
         bool m_hasBackground = false;
+        std::uint64_t m_revision = 0; // Bumped whenever walls or pawns change #
 
     public:
         Board(); // Initialize board data #
@@ -37,7 +41,8 @@ namespace Game
         const std::vector<Wall> &getAllWalls() const; // Get all walls #
         const std::vector<Pawn> &getAllPawns() const; // Get all pawns #
         void setPawns(int p1x, int p1y, int p2x, int p2y); // Set pawn positions #
-        bool loadFromState(const GameState &state); // Sync board from state #
+        bool loadFromState(const GameState &state); // Full rebuild from state (load/reset) #
+        bool applyMove(const Move &move); // Apply one rules-checked move in place #
 
         const Pawn *getPawnAt(int x, int y) const; // Find pawn at grid #
         Pawn *getPawnById(int id); // Find pawn by id #
@@ -47,8 +52,12 @@ namespace Game
         bool movePawn(int pawnId, int targetX, int targetY); // Move a pawn #
 
         bool isValid(int x, int y) const; // Check bounds #
+        std::uint64_t revision() const; // Change counter for view caches #
 
         void toggleWall(int x, int y, Orientation ori, bool blocking); // Block/unblock edges #
+
+    private:
+        bool addWall(int x, int y, Orientation orientation); // Insert a wall the rules already accepted #
     };
 
 }
@@ -0,0 +1,51 @@
+#pragma once
+#include "game/GameState.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Game
+{
+    struct WallSetKey // Exact wall layout plus seat count #
+    {
+        uint64_t hWalls = 0; // Horizontal anchors, one bit each #
+        uint64_t vWalls = 0; // Vertical anchors, one bit each #
+        uint64_t seats = 0; // Seated players (grids differ for 2 and 4) #
+    };
+
+    // Bounded, lock-free map from wall layouts to goal-distance grids, shared by all threads.
+    // Distances depend only on walls, so transpositions of wall moves reuse one BFS.
+    // Each slot is a seqlock: writers claim it with a CAS; readers never wait and treat a torn read as a miss.
+    class DistanceCache
+    {
+    public:
+        static constexpr size_t ENTRIES = 1 << 13; // Slots (direct mapped) #
+
+        static DistanceCache &instance(); // Process-wide cache #
+        static WallSetKey keyFor(const GameState &state); // Build the wall key of a state #
+
+        bool probe(const WallSetKey &key,
+                   int16_t grids[][GameState::BOARD_SIZE][GameState::BOARD_SIZE]) const; // Copy out cached grids #
+        void store(const WallSetKey &key,
+                   const int16_t grids[][GameState::BOARD_SIZE][GameState::BOARD_SIZE]); // Publish grids #
+        void clear(); // Drop all entries #
+
+    private:
+        static constexpr int CELLS = GameState::BOARD_SIZE * GameState::BOARD_SIZE;
+        static constexpr int WORDS = (GameState::MAX_PLAYERS * CELLS + 7) / 8;
+
+        struct Entry
+        {
+            std::atomic<uint64_t> sequence{0}; // Odd while a writer owns the slot #
+            std::atomic<uint64_t> hWalls{0};
+            std::atomic<uint64_t> vWalls{0};
+            std::atomic<uint64_t> seats{0}; // 0 marks an empty slot #
+            std::atomic<uint64_t> distances[WORDS]; // One signed byte per cell per seat #
+        };
+
+        DistanceCache();
+
+        std::unique_ptr<Entry[]> m_entries;
+    };
+}
@@ -1,5 +1,4 @@
 #pragma once
-#include <string>
 
 namespace Game
 {
@@ -26,7 +25,5 @@ namespace Game
         }
 
         virtual bool isValidMove(const Board &board, int targetX, int targetY) const = 0; // Validate a move #
-
-        virtual std::string getTexturePath() const = 0; // Texture path for visuals #
     };
 }
@@ -0,0 +1,47 @@
+#pragma once
+#include "game/GameState.hpp"
+#include "game/Move.hpp"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Game
+{
+    struct RecordedMove // One ply of a game record #
+    {
+        Move move; // Move played #
+        bool searched = false; // Move came from the engine #
+        int score = 0; // Engine score for the mover #
+        int depth = 0; // Engine search depth #
+        int64_t nodes = 0; // Engine nodes visited #
+        int timeMs = 0; // Engine search time #
+    };
+
+    // PGN-like move list: [Tag "value"] header lines, then numbered moves in
+    // standard notation with optional {score depth nodes time} comments, then the result.
+    class GameRecord
+    {
+    public:
+        void reset(const GameState &start); // Start a new record from a position #
+        void setTag(const std::string &name, const std::string &value); // Set or replace a header tag #
+        std::string tag(const std::string &name) const; // Read a header tag ("" if missing) #
+        void addMove(const RecordedMove &move); // Append a ply #
+
+        const GameState &start() const; // Starting position #
+        const std::vector<RecordedMove> &moves() const; // Plies in order #
+        bool empty() const; // Check for no plies #
+
+        std::string toText() const; // Serialize the record #
+        bool fromText(const std::string &text); // Parse a record (moves are replayed for legality) #
+        bool save(const std::string &path) const; // Write to a file #
+        bool load(const std::string &path); // Read from a file #
+
+    private:
+        GameState m_start{};
+        std::vector<std::pair<std::string, std::string>> m_tags;
+        std::vector<RecordedMove> m_moves;
+    };
+
+    std::string resultText(const GameState &state); // "1-0", "0-1", "0-0-1-0" or "*" #
+}
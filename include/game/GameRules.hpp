@@ -16,11 +16,30 @@ namespace Game
         uint8_t distDirty; // Previous distance dirty flag #
     };
 
-    void initGameState(GameState &state); // Initialize a new game state #
+    struct MoveList // Fixed-capacity move buffer (no heap use) #
+    {
+        static constexpr int CAPACITY = 16 + 2 * GameState::WALL_GRID * GameState::WALL_GRID;
+
+        Move moves[CAPACITY]; // Move storage #
+        int size = 0; // Number of moves stored #
+
+        void clear() { size = 0; } // Drop all moves #
+        void push(const Move &move) { moves[size++] = move; } // Append a move #
+        bool empty() const { return size == 0; } // Check for no moves #
+        const Move &operator[](int index) const { return moves[index]; } // Access a move #
+        const Move *begin() const { return moves; } // Range begin #
+        const Move *end() const { return moves + size; } // Range end #
+    };
+
+    void initGameState(GameState &state, int playerCount = 2); // Initialize a new game state #
 
+    int playerCount(const GameState &state); // Get number of seated players #
+    int nextPlayer(const GameState &state, int playerId); // Get the player after playerId #
     int currentPlayer(const GameState &state); // Get current player id #
     int winner(const GameState &state); // Get winner id #
     bool isGameOver(const GameState &state); // Check for game over #
+    bool isGoalCell(int playerId, int x, int y); // Check if a cell is on a player's goal side #
+    bool isPositionConsistent(const GameState &state); // No shared pawn cells, no overlapping or crossing walls #
 
     bool isPawnMoveValid(const GameState &state, int playerId, int targetX, int targetY); // Validate pawn move #
     bool isWallPlacementValid(const GameState &state, int playerId, int x, int y, Orientation orientation); // Validate wall placement #
@@ -29,6 +48,10 @@ namespace Game
     bool applyMoveUnchecked(GameState &state, const Move &move, MoveUndoState &undoState); // Apply without validation #
     void undoMove(GameState &state, const Move &move, const MoveUndoState &undoState); // Undo a move #
     std::vector<Move> generateLegalMoves(const GameState &state); // Generate legal moves #
+    void generateLegalMoves(const GameState &state, MoveList &moves); // Generate legal moves into a buffer #
+    void generatePawnMoves(const GameState &state, MoveList &moves); // Append legal pawn moves #
+    void generateWallMoves(const GameState &state, MoveList &moves); // Append locally legal walls #
+    int strongestOpponent(GameState &state, int playerId); // Opponent closest to its goal #
     int evaluateState(GameState &state, int perspectivePlayerId); // Score a state #
 
     void computeDistancesToGoal(const GameState &state, int playerId,
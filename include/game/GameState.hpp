@@ -7,15 +7,18 @@ namespace Game
     {
         static constexpr int BOARD_SIZE = 9;
         static constexpr int WALL_GRID = 8;
+        static constexpr int MAX_PLAYERS = 4;
         static constexpr int MAX_WALLS_PER_PLAYER = 10;
+        static constexpr int MAX_WALLS_PER_PLAYER_4P = 5;
 
-        uint8_t pawnX[2]; // Pawn x positions #
-        uint8_t pawnY[2]; // Pawn y positions #
-        uint8_t wallsRemaining[2]; // Walls remaining per player #
+        uint8_t pawnX[MAX_PLAYERS]; // Pawn x positions #
+        uint8_t pawnY[MAX_PLAYERS]; // Pawn y positions #
+        uint8_t wallsRemaining[MAX_PLAYERS]; // Walls remaining per player #
         uint8_t hWalls[WALL_GRID][WALL_GRID]; // Horizontal wall anchors #
         uint8_t vWalls[WALL_GRID][WALL_GRID]; // Vertical wall anchors #
-        int16_t distToGoal[2][BOARD_SIZE][BOARD_SIZE]; // Distance grid per player #
+        int16_t distToGoal[MAX_PLAYERS][BOARD_SIZE][BOARD_SIZE]; // Distance grid per player #
         uint8_t distDirty; // Distance cache dirty flag #
+        uint8_t playerCount; // Number of seated players (2 or 4) #
         uint8_t currentPlayerId; // Active player id #
         uint8_t winnerId; // Winner id or 0 #
     };
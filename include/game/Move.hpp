@@ -14,6 +14,7 @@ namespace Game
         int m_playerId;
 
     public:
+        Move(); // Build an empty pawn move #
         Move(MoveType type, int x, int y, Orientation orientation, int playerId); // Build a move #
 
         static Move Pawn(int x, int y, int playerId); // Pawn move factory #
@@ -25,4 +26,6 @@ namespace Game
         Orientation orientation() const; // Get wall orientation #
         int playerId() const; // Get player id #
     };
+
+    bool sameMove(const Move &a, const Move &b); // Same move; a player id of 0 matches any player #
 }
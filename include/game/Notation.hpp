@@ -0,0 +1,17 @@
+#pragma once
+#include "game/GameState.hpp"
+#include "game/Move.hpp"
+#include <string>
+
+namespace Game
+{
+    // Squares use files a-i (x 0-8) and ranks 1-9 counted from player 1's side.
+    // Walls are named by the square at their south-west end plus 'h' or 'v' (e.g. "e3h").
+    std::string squareToText(int x, int y); // Square name, e.g. "e1" #
+    std::string moveToText(const Move &move); // Pawn "e2" or wall "e3h" #
+    bool parseMove(const std::string &text, int playerId, Move &move); // Parse a move for a player #
+
+    // Positions: "<pawns> <walls|-> <walls left> <side to move>", e.g. "e1,e9 d4h,e6v 9,10 2".
+    std::string positionToText(const GameState &state); // Encode a position #
+    bool parsePosition(const std::string &text, GameState &state); // Decode a position #
+}
@@ -1,10 +1,10 @@
 #pragma once
-#include "game/VisualEntity.hpp"
+#include "game/Entity.hpp"
 
 namespace Game
 {
 
-    class Pawn : public VisualEntity
+    class Pawn : public Entity
     {
     private:
         int m_id;
@@ -15,8 +15,5 @@ namespace Game
         int id() const; // Get pawn id #
 
         bool isValidMove(const Board &board, int targetX, int targetY) const override; // Validate pawn move #
-        std::string getTexturePath() const override; // Pawn texture path #
-
-        sf::Vector2f getSpriteOrigin(const sf::Vector2u &texSize) const override; // Pawn sprite origin #
     };
 }
@@ -0,0 +1,32 @@
+#pragma once
+#include "game/GameState.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Game
+{
+    // Fixed-size binary position for corpus files (all fields little-endian):
+    //   [0..3]   pawn cell per seat (y*9+x, 0xFF when unseated)
+    //   [4..11]  horizontal wall anchors, bit y*8+x
+    //   [12..19] vertical wall anchors, bit y*8+x
+    //   [20..21] walls left per seat, one nibble each
+    //   [22]     side to move (bits 0-1, id-1) and four-player flag (bit 2)
+    //   [23]     reserved (0)
+    struct PositionRecord // Packed position #
+    {
+        static constexpr size_t SIZE = 24;
+
+        uint8_t bytes[SIZE] = {}; // Raw record bytes #
+    };
+
+    inline uint64_t wallBit(int x, int y) // Bit for a wall anchor in packed layouts #
+    {
+        return uint64_t(1) << (y * GameState::WALL_GRID + x);
+    }
+
+    void packWalls(const GameState &state, uint64_t &hWalls, uint64_t &vWalls); // Walls to bitsets #
+    void unpackWalls(uint64_t hWalls, uint64_t vWalls, GameState &state); // Bitsets to walls #
+
+    void encodePosition(const GameState &state, PositionRecord &record); // Pack a state #
+    bool decodePosition(const PositionRecord &record, GameState &state); // Unpack a record; rejects bad ranges, shared cells and clashing walls #
+}
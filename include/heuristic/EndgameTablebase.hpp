@@ -0,0 +1,70 @@
+#pragma once
+#include "game/GameState.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Game
+{
+    struct TablebaseKey // Wall layout plus walls left per side #
+    {
+        uint64_t hWalls = 0; // Horizontal anchors, bit y*8+x #
+        uint64_t vWalls = 0; // Vertical anchors, bit y*8+x #
+        uint8_t wallsRemaining[2] = {0, 0}; // Walls left for players 1 and 2 #
+
+        bool operator==(const TablebaseKey &other) const; // Compare keys #
+    };
+
+    struct TablebaseKeyHash // Hash functor for TablebaseKey #
+    {
+        size_t operator()(const TablebaseKey &key) const;
+    };
+
+    struct TablebaseResult // Exact outcome for the side to move #
+    {
+        int outcome = 0; // +1 win, -1 loss, 0 draw #
+        int plies = 0; // Plies until the game ends (0 for draws) #
+    };
+
+    class EndgameTablebase // Retrograde pawn-race tables for a fixed wall layout #
+    {
+    public:
+        static constexpr int MAX_TOTAL_WALLS = 1; // Largest wall total that gets a table #
+
+        explicit EndgameTablebase(size_t maxTables = 512); // Create an empty cache #
+
+        void setStorageDirectory(const std::string &path); // Enable on-disk tables ("" disables) #
+        void clear(); // Drop cached tables #
+
+        static bool covers(const GameState &state, int maxTotalWalls); // Check if a state can use tables #
+        static TablebaseKey keyFor(const GameState &state); // Build the table key of a state #
+
+        bool prepare(const GameState &state, const std::function<bool()> &shouldStop = {}); // Load or generate the table for a state; false if stopped first #
+        bool probe(const GameState &state, TablebaseResult &result) const; // Look up a cached result #
+
+        size_t tableCount() const; // Number of tables in memory #
+
+    private:
+        struct Table
+        {
+            std::vector<int16_t> values; // Encoded outcome per position #
+        };
+
+        const Table *ensureTable(const TablebaseKey &key, const std::function<bool()> &shouldStop); // Load/build with dependencies, null if stopped #
+        std::unique_ptr<Table> generate(const TablebaseKey &key, const std::function<bool()> &shouldStop); // Retrograde analysis, null if stopped #
+        std::unique_ptr<Table> loadFromDisk(const TablebaseKey &key) const; // Read compressed table #
+        void saveToDisk(const TablebaseKey &key, const Table &table) const; // Write compressed table #
+        std::string pathFor(const TablebaseKey &key) const; // File path for a key #
+        const Table &insert(const TablebaseKey &key, std::unique_ptr<Table> table); // Add to cache #
+
+        std::unordered_map<TablebaseKey, std::unique_ptr<Table>, TablebaseKeyHash> m_tables;
+        std::deque<TablebaseKey> m_insertOrder;
+        size_t m_maxTables = 512;
+        std::string m_storageDirectory;
+    };
+}
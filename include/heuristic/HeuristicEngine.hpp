@@ -1,8 +1,14 @@
 #pragma once
+#include "heuristic/EndgameTablebase.hpp"
 #include "heuristic/TranspositionTable.hpp"
 #include "game/GameState.hpp"
 #include "game/Move.hpp"
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
 
 namespace Game
 {
@@ -17,25 +23,64 @@ namespace Game
     struct HeuristicSearchConfig // Search tuning parameters #
     {
         int maxDepth = 4; // Max search depth #
-        int timeLimitMs = 4000; // Time budget in ms #
+        int timeLimitMs = 4000; // Per-move cap in ms when no game clock is set #
+        int clockMs = 0; // Time left on the mover's game clock (0 = use timeLimitMs) #
+        int incrementMs = 0; // Time added to the clock after each move #
+        int moveTimeMs = 0; // Fixed time per move, overriding clock and timeLimitMs (0 = off) #
+        int64_t maxNodes = 0; // Node budget (0 = unlimited) #
+        bool deterministic = false; // Ignore the clock so only depth and maxNodes stop the search #
         HeuristicDifficulty difficulty = HeuristicDifficulty::Medium; // Difficulty #
         int weightDistance = 10; // Distance weight #
         int weightWalls = 2; // Walls weight #
         int weightWidth = 1; // Width weight #
+        int contempt = 0; // Repetitions score -contempt for the searching side (positive avoids draws) #
+        int tablebaseMaxWalls = 1; // Max total walls left to use endgame tables (-1 disables) #
+        std::string tablebasePath; // Directory for on-disk endgame tables (empty = memory only) #
     };
 
+    struct HeuristicSearchInfo // Statistics from the last search #
+    {
+        int score = 0; // Root score for the side to move #
+        int depth = 0; // Deepest completed iteration #
+        int64_t nodes = 0; // Nodes visited #
+        int elapsedMs = 0; // Search time in ms #
+        bool timedOut = false; // Search stopped on the time limit, node budget or stop flag #
+        std::vector<Move> pv; // Expected line from the root, best move first #
+    };
+
+    struct EvaluationFeatures // Terms of the heuristic evaluation before weighting #
+    {
+        int distance = 0; // Leading opponent's path length minus ours #
+        int walls = 0; // Our walls left minus the leading opponent's #
+        int width = 0; // Our path-shortening neighbors minus the leading opponent's #
+    };
+
+    EvaluationFeatures evaluationFeatures(GameState &state, int perspectivePlayerId); // Terms for a player (paths must be open) #
+    int weightedEvaluation(const EvaluationFeatures &features, const HeuristicSearchConfig &config); // Apply the config weights #
+
+    using SearchInfoCallback = std::function<void(const HeuristicSearchInfo &)>; // Called after each iteration #
+
     class HeuristicEngine
     {
     public:
-        explicit HeuristicEngine(HeuristicSearchConfig config = {});
+        explicit HeuristicEngine(HeuristicSearchConfig config = {}, size_t ttEntries = 1 << 20);
 
         void setConfig(const HeuristicSearchConfig &config);
         const HeuristicSearchConfig &config() const;
 
-        Move findBestMove(const GameState &state);
+        Move findBestMove(const GameState &state,
+                          const std::vector<ZobristKeys> &history = {}); // history: keys of earlier game positions #
+        const HeuristicSearchInfo &lastSearchInfo() const; // Stats of the last findBestMove #
+
+        void setStopFlag(const std::atomic<bool> *stop); // Flag that ends a running search when set #
+        void setInfoCallback(SearchInfoCallback callback); // Report each completed iteration #
 
     private:
         HeuristicSearchConfig m_config;
         TranspositionTable m_tt;
+        EndgameTablebase m_tablebase;
+        HeuristicSearchInfo m_lastInfo;
+        const std::atomic<bool> *m_stop = nullptr;
+        SearchInfoCallback m_infoCallback;
     };
 }
@@ -0,0 +1,30 @@
+#pragma once
+#include "heuristic/HeuristicEngine.hpp"
+#include "game/GameState.hpp"
+#include "game/Move.hpp"
+
+namespace Game
+{
+    class TimeManager // Per-move soft/hard limits from the clock, game phase and search stability #
+    {
+    public:
+        void start(const HeuristicSearchConfig &config, GameState &state); // Allocate limits for this move #
+        void onIteration(const Move &bestMove, int score); // Feed the result of a finished iteration #
+        bool shouldStop(int elapsedMs) const; // Check if another iteration is worth starting #
+
+        int softLimitMs() const; // Target time for this move #
+        int hardLimitMs() const; // Time the search must never exceed #
+
+    private:
+        int m_softMs = 0;
+        int m_hardMs = 0;
+        bool m_fixed = false; // Fixed move time: no stability or phase scaling #
+        int m_swingScore = 0; // Score change treated as a swing #
+        int m_iterations = 0;
+        int m_stableIterations = 0; // Iterations in a row with the same best move #
+        bool m_bestChanged = false;
+        bool m_scoreSwing = false;
+        Move m_lastBest;
+        int m_lastScore = 0;
+    };
+}
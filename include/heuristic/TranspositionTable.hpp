@@ -38,5 +38,18 @@ namespace Game
         size_t m_mask = 0;
     };
 
+    struct ZobristKeys // Hashes of a state and of its left-right mirror #
+    {
+        uint64_t key = 0; // Hash of the state as given #
+        uint64_t mirrorKey = 0; // Hash of the state mirrored about the central file #
+        bool mirrorable = false; // Mirror is an equivalent position (two players only) #
+
+        uint64_t canonical() const { return mirrored() ? mirrorKey : key; } // Key used by the TT #
+        bool mirrored() const { return mirrorable && mirrorKey < key; } // Canonical form is the mirror #
+        bool symmetric() const { return mirrorable && mirrorKey == key; } // State equals its mirror #
+    };
+
     uint64_t computeZobrist(const GameState &state); // Zobrist hash of state #
+    ZobristKeys computeZobristKeys(const GameState &state); // Hashes of state and mirror in one pass #
+    Move mirrorMove(const Move &move); // Reflect a move about the central file #
 }
@@ -0,0 +1,74 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace UI
+{
+    struct DecodedSound // PCM samples ready to become an sf::SoundBuffer #
+    {
+        std::vector<std::int16_t> samples;
+        unsigned int channelCount = 0;
+        unsigned int sampleRate = 0;
+        std::vector<sf::SoundChannel> channelMap;
+    };
+
+    class AssetLoader // Decodes images and sounds on worker threads; the main thread hands them to ResourceCache #
+    {
+    public:
+        AssetLoader() = default;
+        ~AssetLoader(); // Wait for running workers #
+
+        AssetLoader(const AssetLoader &) = delete;
+        AssetLoader &operator=(const AssetLoader &) = delete;
+
+        void addImage(const std::string &path); // Queue an image decode (before start) #
+        void addSound(const std::string &path); // Queue a sound decode (before start) #
+        void start(unsigned int threads = 0); // Launch workers (0 = hardware concurrency) #
+
+        std::size_t collect(); // Main thread: move finished assets into the cache, return how many #
+        std::size_t total() const; // Queued assets #
+        std::size_t collected() const; // Assets already handed to the cache #
+        bool isDone() const; // Every queued asset was collected #
+
+        static bool decodeSound(const std::string &path, DecodedSound &sound); // Read a whole file as 16-bit PCM, via the PCM cache #
+
+        static constexpr const char *PCM_CACHE_DIRECTORY = "cache/sfx"; // Raw samples of decoded sounds #
+
+    private:
+        struct Job
+        {
+            std::string path;
+            bool isSound = false;
+        };
+
+        struct Result
+        {
+            std::size_t job = 0;
+            std::shared_ptr<sf::Image> image;
+            std::shared_ptr<DecodedSound> sound;
+            double decodeMs = 0.0;
+            unsigned int worker = 0;
+        };
+
+        void work(unsigned int worker); // Worker loop: claim jobs until none are left #
+
+        std::vector<Job> m_jobs;
+        std::atomic<std::size_t> m_nextJob{0};
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mutex; // Guards m_finished #
+        std::vector<Result> m_finished;
+
+        std::size_t m_collected = 0;
+        std::chrono::steady_clock::time_point m_startTime;
+    };
+}
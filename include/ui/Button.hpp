@@ -30,7 +30,7 @@ namespace UI
     private:
         void updateLabelPosition(); // Center label in button #
 
-        sf::Font m_font;
+        ResourceHandle<sf::Font> m_font;
         sf::Text m_label;
         unsigned int m_baseFontSize = 36;
         std::function<void()> m_onClick;
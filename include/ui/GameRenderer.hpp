@@ -1,25 +1,52 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "game/Board.hpp"
+#include "ui/TextureAtlas.hpp"
+#include <array>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace UI
 {
     class GameRenderer
     {
     private:
+        enum AtlasImage // Order of the images packed into the board atlas #
+        {
+            ATLAS_TILE,
+            ATLAS_WALL_UPPER,
+            ATLAS_WALL_DOWN,
+            ATLAS_PAWN_P1,
+            ATLAS_PAWN_P2
+        };
+
+        struct CellItem // Pawn or wall half drawn on top of a cell's tile #
+        {
+            AtlasImage image;
+            Game::Orientation orientation;
+            bool isPreview;
+        };
+
         sf::Vector2f cartesianToIsometric(int gridX, int gridY) const; // Grid to screen #
-        void applyWallTransform(sf::Sprite &sprite, sf::Vector2f &pos, Game::Orientation orientation) const; // Orient wall #
-        void drawWallPart(sf::RenderWindow &window, sf::Vector2i gridPos, Game::Orientation orientation, const sf::Sprite &baseSprite, bool isPreview); // Draw wall part #
-        void drawTile(sf::RenderWindow &window, int gridX, int gridY); // Draw tile #
-        void drawPawnAt(sf::RenderWindow &window, const std::vector<Game::Pawn> &pawns, int gridX, int gridY); // Draw pawn #
-        void drawWallsAt(sf::RenderWindow &window, const std::vector<Game::Wall> &walls, int gridX, int gridY); // Draw walls #
+        void appendQuad(AtlasImage image, sf::Vector2f position, sf::Vector2f origin, sf::Vector2f scale, sf::Color color); // Emit one sprite quad #
+        void appendWallPart(sf::Vector2i gridPos, Game::Orientation orientation, AtlasImage image, bool isPreview); // Emit wall part #
+        void appendTile(int gridX, int gridY); // Emit tile #
+        void appendCellItem(const CellItem &item, int gridX, int gridY); // Emit pawn or wall part #
+        void rebuildCellIndex(const Game::Board &board); // Bucket pawns, walls, and preview by cell #
+
+        // Tiles, walls and pawns share one atlas, so the whole board is one batch drawn back to front.
+        TextureAtlas m_atlas;
+        sf::VertexArray m_batch;
 
-        // Textures (Must stay alive while game runs)
-        sf::Texture m_texTile;
+        // Items per cell in draw order, as a flat array with per-cell offsets (rebuilt on board or preview change).
+        static constexpr int CELL_COUNT = Game::Board::SIZE * Game::Board::SIZE;
+        std::array<int, CELL_COUNT + 1> m_cellStart{};
+        std::vector<CellItem> m_cellItems;
+        const Game::Board *m_indexedBoard = nullptr;
+        std::uint64_t m_indexedRevision = 0;
+        bool m_cellIndexDirty = true;
 
-        // Flyweight Sprite for tiles
-        sf::Sprite m_spriteTile;
         sf::Vector2i m_hoveredCoords = {-1, -1};
 
         bool m_showWallPreview = false;
@@ -1,5 +1,6 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "ui/ResourceCache.hpp"
 
 namespace UI
 {
@@ -7,22 +8,33 @@ namespace UI
     class Hud
     {
     private:
-        sf::Texture m_player1IndicatorTexture;
-        sf::Texture m_player2IndicatorTexture;
+        ResourceHandle<sf::Texture> m_player1IndicatorTexture;
+        ResourceHandle<sf::Texture> m_player2IndicatorTexture;
         sf::Sprite m_player1IndicatorSprite;
         sf::Sprite m_player2IndicatorSprite;
         bool m_hasIndicators = false;
-        sf::Font m_font;
+        ResourceHandle<sf::Font> m_font;
         sf::Text m_player1WallsText;
         sf::Text m_player2WallsText;
         bool m_hasFont = false;
         int m_currentPlayerId = 1;
 
+        // Retained layout, rebuilt on resize; texts are re-aligned when their string changes.
+        sf::View m_view;
+        sf::Vector2u m_layoutWindowSize;
+        bool m_hasLayout = false;
+        sf::Vector2f m_player1TextAnchor; // Right edge, vertical center #
+        sf::Vector2f m_player2TextAnchor; // Left edge, vertical center #
+
+        void applyTurnColors(); // Tint the active player's indicator and counter #
+        void alignTexts(); // Re-anchor texts after a string or size change #
+
     public:
         Hud(); // Build HUD state #
 
         bool init(); // Load indicator assets and font #
         void update(int currentPlayerId, int p1WallsRemaining, int p2WallsRemaining, int maxWallsPerPlayer); // Update counters #
+        void handleResize(sf::Vector2u windowSize); // Recompute view, scales and text sizes #
         void render(sf::RenderWindow &window); // Draw HUD #
     };
 }
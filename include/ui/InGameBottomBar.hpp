@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <functional>
+#include "ui/ResourceCache.hpp"
 
 namespace UI
 {
@@ -13,12 +14,14 @@ namespace UI
         void setOnToggleWallMode(std::function<void()> onToggleWallMode); // Register wall mode toggle #
         void setOnRotateWall(std::function<void()> onRotateWall); // Register rotate action #
         void setWallPlacementActive(bool active); // Set wall mode state #
+        void handleResize(sf::Vector2u windowSize); // Recompute layout for a new window size #
         bool handleEvent(const sf::Event &event, sf::RenderWindow &window); // Handle input #
         void render(sf::RenderWindow &window); // Draw bottom bar #
         void resetHover(); // Clear hover state #
 
     private:
-        void updateLayout(const sf::RenderWindow &window); // Recompute layout #
+        void ensureLayout(sf::Vector2u windowSize); // Lay out again only if the window size changed #
+        void updateLayout(sf::Vector2u windowSize); // Recompute layout #
         void updateHoverState(const sf::Vector2f &worldPos); // Update hover flags #
         void applyHoverColor(); // Apply hover colors #
         void layoutControlsIcons(); // Position control icons/labels #
@@ -32,7 +35,7 @@ namespace UI
 
         sf::View m_view;
         sf::RectangleShape m_bar;
-        sf::Texture m_hamburgerTexture;
+        ResourceHandle<sf::Texture> m_hamburgerTexture;
         sf::Sprite m_hamburgerSprite;
         sf::FloatRect m_barBounds;
         sf::FloatRect m_hamburgerBounds;
@@ -43,13 +46,13 @@ namespace UI
         std::function<void()> m_onToggleWallMode;
         std::function<void()> m_onRotateWall;
 
-        sf::Texture m_wIconTexture;
-        sf::Texture m_rIconTexture;
+        ResourceHandle<sf::Texture> m_wIconTexture;
+        ResourceHandle<sf::Texture> m_rIconTexture;
         sf::Sprite m_wIconSprite;
         sf::Sprite m_rIconSprite;
         sf::FloatRect m_wIconBounds;
         sf::FloatRect m_rIconBounds;
-        sf::Font m_font;
+        ResourceHandle<sf::Font> m_font;
         sf::Text m_wLabel;
         sf::Text m_rLabel;
         bool m_hasFont = false;
@@ -62,5 +65,7 @@ namespace UI
         float m_layoutScale = 1.f;
         float m_barHeight = 0.f;
         float m_barPadding = 0.f;
+        sf::Vector2u m_layoutWindowSize; // Window size of the current layout #
+        bool m_hasLayout = false;
     };
 }
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "ui/ResourceCache.hpp"
 #include "ui/StateComponent.hpp"
 
 namespace UI
@@ -33,7 +34,7 @@ namespace UI
         void updateScreenBackdrop(const sf::View &view); // Update backdrop geometry #
 
         bool m_enabled = false;
-        sf::Texture m_backgroundTexture;
+        ResourceHandle<sf::Texture> m_backgroundTexture;
         sf::Sprite m_backgroundSprite;
         bool m_hasBackground = false;
         bool m_screenBackdropEnabled = false;
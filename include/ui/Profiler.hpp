@@ -0,0 +1,97 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace UI
+{
+    struct ProfileSample // One timed zone; names must be string literals #
+    {
+        const char *zone = "";
+        const char *screen = "";
+        std::uint64_t startNs = 0; // Since the profiler was created #
+        std::uint64_t durationNs = 0;
+        std::uint32_t frame = 0;
+        std::uint16_t depth = 0; // Nesting level (0 = whole frame) #
+    };
+
+    struct FrameStats // Presented frame times in milliseconds #
+    {
+        std::size_t count = 0;
+        float average = 0.f;
+        float p50 = 0.f;
+        float p95 = 0.f;
+        float p99 = 0.f;
+        float max = 0.f;
+    };
+
+    class Profiler // Frame and zone timings kept in lock-free ring buffers #
+    {
+    public:
+        static constexpr std::size_t SAMPLE_CAPACITY = 8192; // Zone samples kept (power of two) #
+        static constexpr std::size_t FRAME_HISTORY = 240; // Presented frame times kept #
+
+        static Profiler &instance(); // Access the singleton instance #
+
+        void setEnabled(bool enabled); // Start or stop recording #
+        bool isEnabled() const; // Check whether zones are recorded #
+
+        void beginFrame(const char *screen); // Open a loop iteration for a screen #
+        void endFrame(bool presented); // Close it; only presented frames enter the frame history #
+        void record(const char *zone, std::uint64_t startNs, std::uint64_t endNs, std::uint16_t depth); // Push a zone sample #
+
+        std::vector<ProfileSample> snapshot() const; // Recorded samples, oldest first #
+        std::vector<float> frameTimes() const; // Presented frame times in ms, oldest first #
+        FrameStats frameStats() const; // Percentiles of the frame history #
+
+        void setSearchRate(std::int64_t nodes, int elapsedMs); // Report CPU search progress (any thread) #
+        double searchRate() const; // Last reported nodes per second #
+
+        bool exportCsv(const std::string &path) const; // One row per sample #
+        bool exportChromeTrace(const std::string &path) const; // Trace Event JSON for chrome://tracing or Perfetto #
+
+        std::uint64_t nowNs() const; // Nanoseconds since the profiler was created #
+        static int &depth(); // Open zones on the calling thread #
+
+    private:
+        Profiler(); // Singleton #
+
+        struct Slot // Sample guarded by a sequence number (odd while being written) #
+        {
+            std::atomic<std::uint64_t> sequence{0};
+            ProfileSample sample;
+        };
+
+        std::array<Slot, SAMPLE_CAPACITY> m_slots;
+        std::atomic<std::uint64_t> m_head{0}; // Samples ever claimed #
+        std::array<std::atomic<std::uint32_t>, FRAME_HISTORY> m_frameUs{}; // Frame times in microseconds #
+        std::atomic<std::uint64_t> m_frameHead{0};
+        std::atomic<bool> m_enabled{false};
+        std::atomic<double> m_searchRate{0.0};
+        std::uint64_t m_epochNs = 0;
+
+        std::atomic<const char *> m_frameScreen{""};
+        std::atomic<std::uint32_t> m_frameIndex{0};
+        // Frames are opened and closed by the main loop only.
+        std::uint64_t m_frameStartNs = 0;
+        bool m_frameOpen = false;
+    };
+
+    class ProfileScope // Times the enclosing block as a named zone when profiling is on #
+    {
+    public:
+        explicit ProfileScope(const char *zone);
+        ~ProfileScope();
+
+        ProfileScope(const ProfileScope &) = delete;
+        ProfileScope &operator=(const ProfileScope &) = delete;
+
+    private:
+        const char *m_zone;
+        std::uint64_t m_startNs = 0;
+        bool m_active = false;
+    };
+}
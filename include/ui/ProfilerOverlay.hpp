@@ -0,0 +1,36 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "ui/ResourceCache.hpp"
+
+namespace UI
+{
+    class ProfilerOverlay // Frame percentiles, histogram, zone costs and search speed drawn over any screen #
+    {
+    public:
+        ProfilerOverlay(); // Build overlay state #
+
+        bool init(); // Load the font #
+        void setVisible(bool visible); // Show or hide; profiling records only while visible #
+        bool isVisible() const; // Check visibility #
+        float refreshDelay() const; // Seconds until the stats are due for a rebuild (0 = now) #
+        void render(sf::RenderWindow &window); // Draw in window pixels on top of the frame #
+
+    private:
+        void refresh(); // Rebuild text and histogram from the profiler #
+
+        static constexpr float REFRESH_SECONDS = 0.25f; // Stats are rebuilt at most this often #
+        static constexpr float PANEL_WIDTH = 560.f;
+        static constexpr float PANEL_PADDING = 10.f;
+        static constexpr float HISTOGRAM_HEIGHT = 60.f;
+        static constexpr float HISTOGRAM_FULL_SCALE_MS = 33.3f; // Frame time drawn at full bar height #
+        static constexpr unsigned int FONT_SIZE = 14;
+
+        ResourceHandle<sf::Font> m_font;
+        sf::Text m_text;
+        sf::RectangleShape m_panel;
+        sf::VertexArray m_histogram;
+        sf::Clock m_refreshClock;
+        bool m_visible = false;
+        bool m_hasFont = false;
+    };
+}
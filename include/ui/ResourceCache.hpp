@@ -0,0 +1,48 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace UI
+{
+    template <typename T>
+    using ResourceHandle = std::shared_ptr<const T>; // Shared, read-only asset #
+
+    class ResourceCache // Images, textures, fonts and sound buffers loaded once per path and shared by handle #
+    {
+    public:
+        static ResourceCache &instance(); // Access the singleton instance #
+
+        ResourceHandle<sf::Texture> texture(const std::string &path); // Load or reuse a texture (null on failure) #
+        ResourceHandle<sf::Font> font(const std::string &path); // Load or reuse a font (null on failure) #
+        ResourceHandle<sf::SoundBuffer> soundBuffer(const std::string &path); // Load or reuse a sound buffer (null on failure) #
+        ResourceHandle<sf::Image> image(const std::string &path); // Load or reuse decoded pixels (null on failure) #
+
+        void store(const std::string &path, ResourceHandle<sf::Image> image); // Adopt pixels decoded elsewhere #
+        void store(const std::string &path, ResourceHandle<sf::SoundBuffer> buffer); // Adopt a buffer built elsewhere #
+
+        std::size_t releaseUnused(); // Drop assets no handle outside the cache refers to #
+
+        static const sf::Texture &emptyTexture(); // Placeholder to bind sprites before loading #
+        static const sf::Font &emptyFont(); // Placeholder to bind texts before loading #
+
+    private:
+        ResourceCache() = default; // Singleton #
+
+        template <typename T, typename Loader>
+        ResourceHandle<T> acquire(std::unordered_map<std::string, ResourceHandle<T>> &entries,
+                                  const std::string &path, Loader load); // Shared lookup/load path #
+
+        template <typename T>
+        static std::size_t releaseFrom(std::unordered_map<std::string, ResourceHandle<T>> &entries); // Evict unshared entries #
+
+        // Failed loads stay cached as null so a missing file is reported once, not every frame.
+        std::unordered_map<std::string, ResourceHandle<sf::Texture>> m_textures;
+        std::unordered_map<std::string, ResourceHandle<sf::Font>> m_fonts;
+        std::unordered_map<std::string, ResourceHandle<sf::SoundBuffer>> m_soundBuffers;
+        std::unordered_map<std::string, ResourceHandle<sf::Image>> m_images; // Textures upload from here when present #
+    };
+}
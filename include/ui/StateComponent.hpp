@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
+#include "ui/ResourceCache.hpp"
 
 namespace UI
 {
@@ -34,8 +35,8 @@ namespace UI
         virtual void onClick(); // Hook for click actions #
 
         ComponentState m_state = ComponentState::Normal;
-        sf::Texture m_tileTexture;
-        sf::Texture m_hoverTileTexture;
+        ResourceHandle<sf::Texture> m_tileTexture;
+        ResourceHandle<sf::Texture> m_hoverTileTexture;
         sf::Sprite m_tileSprite;
         sf::Sprite m_hoverTileSprite;
 
@@ -0,0 +1,23 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+namespace UI
+{
+    class TextureAtlas // Several images packed into one texture so they can share a draw call #
+    {
+    public:
+        bool build(const std::vector<std::string> &paths); // Load and pack images in path order #
+
+        const sf::Texture &texture() const; // Packed texture #
+        const sf::IntRect &region(std::size_t index) const; // Pixel rect of the index-th image #
+
+    private:
+        static constexpr unsigned int PADDING = 2; // Gap against sampling bleed between images #
+        static constexpr unsigned int MAX_WIDTH = 2048;
+
+        sf::Texture m_texture;
+        std::vector<sf::IntRect> m_regions;
+    };
+}
@@ -2,6 +2,11 @@
 #include "audio/SfxManager.hpp"
 #include "game/GameRules.hpp"
 #include "game/Move.hpp"
+#include "ui/Profiler.hpp"
+#include "ui/ResourceCache.hpp"
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
 #include <iostream>
 #include <exception>
 #include <stdexcept>
@@ -10,12 +15,46 @@
 namespace App
 {
 
-    // Build window, initialize screens, and wire navigation callbacks. #
+    // Build window and show the loading screen while startup assets decode in the background. #
     Application::Application()
         : m_window(sf::VideoMode({1280, 720}), "Quoridor Isometric")
     {
         m_window.setFramerateLimit(60);
+        m_profilerOverlay.init();
 
+        queueStartupAssets();
+        m_assetLoader.start();
+
+        m_loadingScreen = std::make_unique<LoadingScreen>(m_assetLoader);
+        if (!m_loadingScreen->init())
+            std::cerr << "LoadingScreen initialization failed\n";
+        m_loadingScreen->setOnFinished([this]()
+                                       { finishStartup(); });
+        setCurrentScreen(m_loadingScreen.get());
+    }
+
+    // Queue every UI image and sound effect for the worker threads. #
+    void Application::queueStartupAssets()
+    {
+        for (const char *directory : STARTUP_IMAGE_DIRECTORIES)
+        {
+            std::error_code ec;
+            for (const auto &entry : std::filesystem::directory_iterator(directory, ec))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".png")
+                    m_assetLoader.addImage(entry.path().generic_string());
+            }
+            if (ec)
+                std::cerr << "Cannot list " << directory << ": " << ec.message() << "\n";
+        }
+
+        for (const std::string &path : Audio::SfxManager::instance().assetPaths())
+            m_assetLoader.addSound(path);
+    }
+
+    // Initialize screens from the warmed cache, and wire navigation callbacks. #
+    void Application::finishStartup()
+    {
         // Fail-fast: preload SFX so missing audio assets stop startup.
         Audio::SfxManager::instance().preloadAll();
 
@@ -23,8 +62,11 @@ namespace App
         {
             try
             {
+                // Mostly texture uploads now; decoding already happened on the workers.
+                sf::Clock clock;
                 if (!screen->init())
                     throw std::runtime_error(std::string(name) + " initialization failed");
+                std::cout << name << " ready in " << clock.getElapsedTime().asMilliseconds() << " ms\n";
             }
             catch (const std::exception &e)
             {
@@ -83,55 +125,126 @@ namespace App
         setCurrentScreen(m_titleScreen.get());
     }
 
-    // Poll window events and forward them to the active screen. #
+    // Sleep while the frame is current; the event that wakes the loop is kept for processEvents. #
+    void Application::waitForActivity()
+    {
+        if (!m_currentScreen || m_currentScreen->needsRedraw())
+            return;
+
+        // Block until input arrives, the screen's next animation/poll step is due, or the visible
+        // profiler overlay needs fresh stats (idle screens would otherwise freeze it).
+        const float wake = m_currentScreen->wakeDelay();
+        float wait = wake < 0.f ? MAX_IDLE_WAIT : std::min(wake, MAX_IDLE_WAIT);
+        if (m_profilerOverlay.isVisible())
+            wait = std::min(wait, m_profilerOverlay.refreshDelay());
+        if (wait > 0.f)
+            m_pendingEvent = m_window.waitEvent(sf::seconds(wait));
+    }
+
+    // Drain pending window events. #
     void Application::processEvents()
     {
+        UI::ProfileScope zone("Application::processEvents");
+        if (m_pendingEvent)
+        {
+            const sf::Event event = *m_pendingEvent;
+            m_pendingEvent.reset();
+            dispatchEvent(event);
+        }
+
         while (const std::optional event = m_window.pollEvent())
+            dispatchEvent(*event);
+    }
+
+    // Forward one event; anything reaching a screen invalidates its frame. #
+    void Application::dispatchEvent(const sf::Event &event)
+    {
+        if (event.is<sf::Event::Closed>())
+        {
+            m_window.close();
+            return;
+        }
+
+        // Profiler keys work on every screen.
+        if (const auto *key = event.getIf<sf::Event::KeyPressed>())
         {
-            if (event->is<sf::Event::Closed>())
+            if (key->code == sf::Keyboard::Key::F3)
             {
-                m_window.close();
-                continue;
+                m_profilerOverlay.setVisible(!m_profilerOverlay.isVisible());
+                if (m_currentScreen)
+                    m_currentScreen->invalidate();
+                return;
             }
-            if (const auto *resized = event->getIf<sf::Event::Resized>())
+            if (key->code == sf::Keyboard::Key::F4)
             {
-                if (m_currentScreen)
-                    m_currentScreen->handleResize(m_window, resized->size);
-                continue;
+                exportProfile();
+                return;
             }
-
-            if (m_currentScreen)
-                m_currentScreen->handleEvent(*event, m_window);
         }
+
+        if (!m_currentScreen)
+            return;
+
+        if (const auto *resized = event.getIf<sf::Event::Resized>())
+            m_currentScreen->handleResize(m_window, resized->size);
+        else
+            m_currentScreen->handleEvent(event, m_window);
+        m_currentScreen->invalidate();
     }
 
-    // Compute delta time and update the active screen. #
+    // Compute delta time, update the active screen and keep a visible overlay refreshing. #
     void Application::update()
     {
+        UI::ProfileScope zone("Application::update");
         const float dt = m_clock.restart().asSeconds();
-        if (m_currentScreen)
-            m_currentScreen->update(dt);
+        if (!m_currentScreen)
+            return;
+        m_currentScreen->tick(dt);
+        if (m_profilerOverlay.isVisible() && m_profilerOverlay.refreshDelay() <= 0.f)
+            m_currentScreen->invalidate();
     }
 
-    // Clear the frame, draw the active screen, and present. #
-    void Application::render()
+    // Draw and present only when the active screen changed since the last frame. #
+    bool Application::render()
     {
+        if (!m_currentScreen || !m_currentScreen->needsRedraw())
+            return false;
+
+        UI::ProfileScope zone("Application::render");
         m_window.clear(sf::Color::Black);
+        m_currentScreen->render(m_window);
+        m_profilerOverlay.render(m_window);
+        m_window.display();
+        m_currentScreen->markDrawn();
+        return true;
+    }
 
-        if (m_currentScreen)
-            m_currentScreen->render(m_window);
+    // Write profiles/profile-<time>.csv and .json from the recorded samples. #
+    void Application::exportProfile()
+    {
+        std::error_code ec;
+        std::filesystem::create_directories("profiles", ec);
+        const std::string base = "profiles/profile-" + std::to_string(std::time(nullptr));
 
-        m_window.display();
+        const UI::Profiler &profiler = UI::Profiler::instance();
+        if (profiler.exportCsv(base + ".csv") && profiler.exportChromeTrace(base + ".json"))
+            std::cout << "Profile written to " << base << ".csv/.json\n";
+        else
+            std::cerr << "Failed to write profile " << base << "\n";
     }
 
-    // Main loop: process events, update state, then render. #
+    // Main loop: idle until needed, then process events, update state and redraw if needed. #
     void Application::run()
     {
+        UI::Profiler &profiler = UI::Profiler::instance();
         while (m_window.isOpen())
         {
+            waitForActivity();
+
+            profiler.beginFrame(m_currentScreen ? m_currentScreen->name() : "");
             processEvents();
             update();
-            render();
+            profiler.endFrame(render());
         }
     }
 
@@ -144,11 +257,15 @@ namespace App
         if (m_currentScreen)
             m_currentScreen->onExit();
 
+        // Assets no screen holds any more are freed between screens.
+        UI::ResourceCache::instance().releaseUnused();
+
         m_currentScreen = screen;
         if (m_currentScreen)
         {
             m_currentScreen->handleResize(m_window, m_window.getSize());
             m_currentScreen->onEnter();
+            m_currentScreen->invalidate();
         }
     }
 }
@@ -13,36 +13,42 @@ namespace App
     static const char *BACKGROUND_PATH = "assets/textures/credits-bg-spirte-sheet.png";
     static const char *FONT_PATH = "assets/fonts/pixelon.ttf";
 
-    // Build SFML text/sprite members with the shared font/texture. #
+    // Build SFML text/sprite members bound to placeholders until init. #
     CreditsScreen::CreditsScreen()
-        : m_backgroundSprite(m_backgroundTexture),
-          m_titleText(m_font),
-          m_bodyText(m_font),
-          m_titleShadow(m_font),
-          m_bodyShadow(m_font)
+        : m_backgroundSprite(UI::ResourceCache::emptyTexture()),
+          m_titleText(UI::ResourceCache::emptyFont()),
+          m_bodyText(UI::ResourceCache::emptyFont()),
+          m_titleShadow(UI::ResourceCache::emptyFont()),
+          m_bodyShadow(UI::ResourceCache::emptyFont())
     {
     }
 
     // Load background, font, and initialize credit text/shadows. #
     bool CreditsScreen::init()
     {
-        if (!m_backgroundTexture.loadFromFile(BACKGROUND_PATH))
+        UI::ResourceCache &cache = UI::ResourceCache::instance();
+        m_backgroundTexture = cache.texture(BACKGROUND_PATH);
+        if (!m_backgroundTexture)
         {
             std::cerr << "Failed to load credits background\n";
             return false;
         }
 
-        m_backgroundSprite.setTexture(m_backgroundTexture, true);
+        m_backgroundSprite.setTexture(*m_backgroundTexture, true);
         m_backgroundSprite.setTextureRect(
             sf::IntRect({0, 0}, {FRAME_WIDTH, FRAME_HEIGHT}));
         m_backgroundSprite.setOrigin({FRAME_WIDTH / 2.f, FRAME_HEIGHT / 2.f});
 
-        if (!m_font.openFromFile(FONT_PATH))
+        m_font = cache.font(FONT_PATH);
+        if (!m_font)
         {
             std::cerr << "Failed to load font for credits screen\n";
             return false;
         }
 
+        for (sf::Text *text : {&m_titleText, &m_bodyText, &m_titleShadow, &m_bodyShadow})
+            text->setFont(*m_font);
+
         m_titleText.setFillColor(sf::Color::White);
         m_bodyText.setString(
             "CHACON GOMEZ Jose Daniel\n"
@@ -124,7 +130,9 @@ namespace App
             m_backgroundSprite.setTextureRect(
                 sf::IntRect({col * FRAME_WIDTH, row * FRAME_HEIGHT},
                             {FRAME_WIDTH, FRAME_HEIGHT}));
+            invalidate();
         }
+        scheduleWake(FRAME_TIME - m_frameTimer);
     }
 
     // Draw the animated background and credit text in UI view space. #
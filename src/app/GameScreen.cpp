@@ -2,7 +2,12 @@
 #include "game/Move.hpp"
 #include "game/GameRules.hpp"
 #include "audio/SfxManager.hpp"
+#include "ui/Profiler.hpp"
+#include <algorithm>
 #include <chrono>
+#include <ctime>
+#include <cstdlib>
+#include <filesystem>
 #include <future>
 #include <exception>
 #include <stdexcept>
@@ -11,6 +16,12 @@
 
 namespace App
 {
+    // Stop the search thread before the engine it uses is destroyed. #
+    GameScreen::~GameScreen()
+    {
+        cancelCpuSearch();
+    }
+
     // Initialize game state, UI, and menu callbacks. #
     bool GameScreen::init()
     {
@@ -20,6 +31,15 @@ namespace App
         m_stateVersion = 0;
         m_cpuPending = false;
         m_cpuThinking = false;
+        m_cpuClockMs = CPU_CLOCK_MS;
+        m_heuristicEngine.setStopFlag(&m_cpuStop);
+        // Runs on the search thread after each iteration; feeds the profiler overlay.
+        m_heuristicEngine.setInfoCallback([](const Game::HeuristicSearchInfo &info)
+                                          { UI::Profiler::instance().setSearchRate(info.nodes, info.elapsedMs); });
+
+        if (const char *recordDir = std::getenv(RECORD_DIR_ENV))
+            m_recordDirectory = recordDir;
+        startGameRecord();
 
         try
         {
@@ -116,10 +136,6 @@ namespace App
                                            m_onQuit(); });
         }
 
-        // Force static wall preview sprites to initialize during startup (fail fast).
-        (void)Game::Wall::previewUpperSprite();
-        (void)Game::Wall::previewDownSprite();
-
         m_bottomBar.setOnClick([this]()
                                {
                                    if (!m_pauseMenu.isEnabled() && !m_winnerMenu.isEnabled())
@@ -155,6 +171,7 @@ namespace App
     // Deactivate the screen and clear UI overlays. #
     void GameScreen::onExit()
     {
+        saveGameRecord();
         resetUIState();
         Screen::onExit();
     }
@@ -261,12 +278,21 @@ namespace App
     void GameScreen::handleResize(sf::RenderWindow &window, sf::Vector2u size)
     {
         m_renderer.handleResize(window, size);
+        m_hud.handleResize(size);
+        m_bottomBar.handleResize(size);
     }
 
     // Drive CPU turn processing each frame. #
     void GameScreen::update(float /*dt*/)
     {
+        const auto version = m_stateVersion;
         updateHeuristicTurn();
+        if (m_stateVersion != version)
+            invalidate();
+
+        // Keep polling the search while the CPU owes a move; otherwise idle until input.
+        if (m_cpuPending || m_cpuThinking)
+            scheduleWake(CPU_POLL_INTERVAL);
     }
 
     // Render gameplay scene, UI bar, HUD, and menus. #
@@ -299,7 +325,8 @@ namespace App
             Audio::SfxManager::instance().play(Audio::SfxId::Click);
             Audio::SfxManager::instance().play(Audio::SfxId::Move);
             ++m_stateVersion;
-            if (!m_board.loadFromState(m_gameState))
+            recordMove(move, nullptr);
+            if (!syncBoard(move))
             {
                 std::cout << "Error: Failed to sync board state." << std::endl;
                 return;
@@ -354,7 +381,8 @@ namespace App
             Audio::SfxManager::instance().play(Audio::SfxId::Click);
             Audio::SfxManager::instance().play(Audio::SfxId::Wall);
             ++m_stateVersion;
-            if (!m_board.loadFromState(m_gameState))
+            recordMove(move, nullptr);
+            if (!syncBoard(move))
             {
                 std::cout << "Error: Failed to sync board state." << std::endl;
                 return;
@@ -403,9 +431,18 @@ namespace App
             m_cpuPending = false;
             m_cpuThinking = true;
             m_cpuStateVersion = m_stateVersion;
+
+            // The engine's config, table and tablebase belong to one search at a time.
+            cancelCpuSearch();
+            Game::HeuristicSearchConfig config = m_heuristicEngine.config();
+            config.clockMs = m_cpuClockMs;
+            config.incrementMs = CPU_INCREMENT_MS;
+            m_heuristicEngine.setConfig(config);
+
             Game::GameState snapshot = m_gameState;
-            m_cpuFuture = std::async(std::launch::async, [this, snapshot]() mutable
-                                     { return m_heuristicEngine.findBestMove(snapshot); });
+            std::vector<Game::ZobristKeys> history = m_positionHistory;
+            m_cpuFuture = std::async(std::launch::async, [this, snapshot, history]() mutable
+                                     { return m_heuristicEngine.findBestMove(snapshot, history); });
         }
 
         if (!m_cpuThinking)
@@ -438,8 +475,10 @@ namespace App
         else
             Audio::SfxManager::instance().play(Audio::SfxId::Wall);
         ++m_stateVersion;
+        m_cpuClockMs = std::max(1, m_cpuClockMs - m_heuristicEngine.lastSearchInfo().elapsedMs) + CPU_INCREMENT_MS;
+        recordMove(move, &m_heuristicEngine.lastSearchInfo());
 
-        if (!m_board.loadFromState(m_gameState))
+        if (!syncBoard(move))
         {
             std::cout << "Error: Failed to sync board state." << std::endl;
             return;
@@ -456,6 +495,17 @@ namespace App
         }
     }
 
+    // Raise the stop flag and wait for the search; its move is discarded. #
+    void GameScreen::cancelCpuSearch()
+    {
+        if (!m_cpuFuture.valid())
+            return;
+        m_cpuStop.store(true);
+        m_cpuFuture.wait();
+        m_cpuFuture = {};
+        m_cpuStop.store(false);
+    }
+
     // Check for a winner and show the winner menu. #
     void GameScreen::checkWinCondition(int playerId)
     {
@@ -467,6 +517,7 @@ namespace App
                 m_winSfxPlayed = true;
             }
             std::cout << "=== Player " << playerId << " has WON! ===" << std::endl;
+            saveGameRecord();
             m_winnerMenu.setWinner(playerId);
             m_winnerMenu.setEnabled(true);
             m_pauseMenu.setEnabled(false);
@@ -478,13 +529,17 @@ namespace App
     // Reset board/game state and refresh UI. #
     void GameScreen::resetGame()
     {
+        saveGameRecord();
         m_board.init();
         Game::initGameState(m_gameState);
         m_board.loadFromState(m_gameState);
+        startGameRecord();
         resetUIState();
         m_stateVersion = 0;
+        cancelCpuSearch();
         m_cpuPending = false;
         m_cpuThinking = false;
+        m_cpuClockMs = CPU_CLOCK_MS;
 
         m_isPlacingWall = false;
         m_currentWallOri = Game::Orientation::Horizontal;
@@ -525,4 +580,77 @@ namespace App
         m_bottomBar.resetHover();
         m_bottomBar.setWallPlacementActive(false);
     }
+
+    // Start an empty move list with header tags for the current mode. #
+    void GameScreen::startGameRecord()
+    {
+        m_record.reset(m_gameState);
+        m_recordSaved = false;
+        m_positionHistory.assign(1, Game::computeZobristKeys(m_gameState));
+
+        char date[16] = {};
+        const std::time_t now = std::time(nullptr);
+        if (const std::tm *local = std::localtime(&now))
+            std::strftime(date, sizeof(date), "%Y.%m.%d", local);
+
+        m_record.setTag("Event", "Quoridor");
+        m_record.setTag("Date", date);
+        m_record.setTag("Player1", "Human");
+        m_record.setTag("Player2", m_gameMode == GameMode::SinglePlayer ? "CPU" : "Human");
+    }
+
+    // Apply a played move to the board view, rebuilding from the state only if the delta does not fit. #
+    bool GameScreen::syncBoard(const Game::Move &move)
+    {
+        return m_board.applyMove(move) || m_board.loadFromState(m_gameState);
+    }
+
+    // Append a played move, with search stats for CPU moves, and remember the new position. #
+    void GameScreen::recordMove(const Game::Move &move, const Game::HeuristicSearchInfo *info)
+    {
+        // A wall can never be taken back, so no earlier position can repeat after one.
+        if (move.type() == Game::MoveType::WallPlacement)
+            m_positionHistory.clear();
+        m_positionHistory.push_back(Game::computeZobristKeys(m_gameState));
+
+        if (m_recordDirectory.empty())
+            return;
+
+        Game::RecordedMove ply;
+        ply.move = move;
+        if (info)
+        {
+            ply.searched = true;
+            ply.score = info->score;
+            ply.depth = info->depth;
+            ply.nodes = info->nodes;
+            ply.timeMs = info->elapsedMs;
+        }
+        m_record.addMove(ply);
+    }
+
+    // Write the current game to the record directory (finished or abandoned). #
+    void GameScreen::saveGameRecord()
+    {
+        if (m_recordDirectory.empty() || m_recordSaved || m_record.empty())
+            return;
+        m_recordSaved = true;
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_recordDirectory, ec);
+
+        char stamp[32] = "game";
+        const std::time_t now = std::time(nullptr);
+        if (const std::tm *local = std::localtime(&now))
+            std::strftime(stamp, sizeof(stamp), "game-%Y%m%d-%H%M%S", local);
+
+        std::filesystem::path path = std::filesystem::path(m_recordDirectory) / (std::string(stamp) + ".qgn");
+        for (int suffix = 2; std::filesystem::exists(path, ec); ++suffix)
+            path = std::filesystem::path(m_recordDirectory) / (std::string(stamp) + "-" + std::to_string(suffix) + ".qgn");
+
+        if (m_record.save(path.string()))
+            std::cout << "Game record saved to " << path.string() << std::endl;
+        else
+            std::cout << "Error: Failed to save game record " << path.string() << std::endl;
+    }
 }
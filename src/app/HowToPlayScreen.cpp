@@ -3,6 +3,7 @@
 #include "ui/UiConstants.hpp"
 #include "ui/ViewUtils.hpp"
 #include <algorithm>
+#include <chrono>
 #include <cctype>
 #include <cstdint>
 #include <cmath>
@@ -20,6 +21,7 @@ namespace App
     static constexpr float INDICATOR_SIZE = 14.f;
     static constexpr float INDICATOR_PADDING = 18.f;
     static constexpr float INDICATOR_BLINK_SPEED = 4.2f;
+    static constexpr float INDICATOR_FRAME_TIME = 1.f / 30.f;
 
     static const char *KNIGHT_BACKGROUND_PATH = "assets/textures/knight_whiteboard.png";
     static const char *WIZARD_BACKGROUND_PATH = "assets/textures/wizard_whiteboard.png";
@@ -28,37 +30,44 @@ namespace App
 
     // Build sprites and texts bound to their textures/fonts. #
     HowToPlayScreen::HowToPlayScreen()
-        : m_backgroundSprite(m_knightBackgroundTexture),
-          m_boardSprite(m_boardTexture),
-          m_dialogueText(m_font),
-          m_speakerNameText(m_font),
-          m_speakerNameShadow(m_font)
+        : m_backgroundSprite(UI::ResourceCache::emptyTexture()),
+          m_boardSprite(UI::ResourceCache::emptyTexture()),
+          m_dialogueText(UI::ResourceCache::emptyFont()),
+          m_speakerNameText(UI::ResourceCache::emptyFont()),
+          m_speakerNameShadow(UI::ResourceCache::emptyFont())
     {
     }
 
     // Load background assets, font, and tutorial steps. #
     bool HowToPlayScreen::init()
     {
-        if (!m_knightBackgroundTexture.loadFromFile(KNIGHT_BACKGROUND_PATH))
+        UI::ResourceCache &cache = UI::ResourceCache::instance();
+        m_knightBackgroundTexture = cache.texture(KNIGHT_BACKGROUND_PATH);
+        if (!m_knightBackgroundTexture)
         {
             std::cerr << "Failed to load knight how-to background\n";
             return false;
         }
 
-        if (!m_wizardBackgroundTexture.loadFromFile(WIZARD_BACKGROUND_PATH))
+        m_wizardBackgroundTexture = cache.texture(WIZARD_BACKGROUND_PATH);
+        if (!m_wizardBackgroundTexture)
         {
             std::cerr << "Failed to load wizard how-to background\n";
             return false;
         }
 
-        m_backgroundSprite.setTexture(m_knightBackgroundTexture, true);
-        const sf::Vector2u bgSize = m_knightBackgroundTexture.getSize();
+        m_backgroundSprite.setTexture(*m_knightBackgroundTexture, true);
+        const sf::Vector2u bgSize = m_knightBackgroundTexture->getSize();
         m_backgroundSprite.setOrigin({static_cast<float>(bgSize.x) / 2.f,
                                       static_cast<float>(bgSize.y) / 2.f});
 
-        if (m_font.openFromFile(FONT_PATH))
+        m_font = cache.font(FONT_PATH);
+        if (m_font)
         {
             m_hasFont = true;
+            m_dialogueText.setFont(*m_font);
+            m_speakerNameText.setFont(*m_font);
+            m_speakerNameShadow.setFont(*m_font);
             m_dialogueText.setFillColor(sf::Color::White);
             m_speakerNameText.setFillColor(sf::Color::White);
             m_speakerNameShadow.setFillColor(sf::Color(0, 0, 0, 180));
@@ -131,15 +140,29 @@ namespace App
         applyStep(0);
     }
 
+    // Drop uploaded board images; decodes still running are collected on the next visit. #
+    void HowToPlayScreen::onExit()
+    {
+        Screen::onExit();
+        m_boardSprite.setTexture(UI::ResourceCache::emptyTexture(), true);
+        m_hasBoardImage = false;
+        m_boardTextures.clear();
+    }
+
     // Animate the continue indicator blink. #
     void HowToPlayScreen::update(float dt)
     {
+        collectBoardImages();
+
         m_blinkTimer += dt;
         const float pulse = (std::sin(m_blinkTimer * INDICATOR_BLINK_SPEED) + 1.f) * 0.5f;
         const std::uint8_t alpha = static_cast<std::uint8_t>(80 + pulse * 175);
         sf::Color color = m_continueIndicator.getFillColor();
+        if (color.a != alpha)
+            invalidate();
         color.a = alpha;
         m_continueIndicator.setFillColor(color);
+        scheduleWake(INDICATOR_FRAME_TIME);
     }
 
     // Draw background, board image, dialogue, and indicator. #
@@ -211,19 +234,7 @@ namespace App
         m_dialogueRect = computeDialogueRect(view);
         m_nameplateRect = computeNameplateRect(view);
 
-        if (m_hasBoardImage)
-        {
-            const sf::Vector2u texSize = m_boardTexture.getSize();
-            if (texSize.x > 0 && texSize.y > 0)
-            {
-                const float scaleX = m_boardRect.size.x / static_cast<float>(texSize.x);
-                const float scaleY = m_boardRect.size.y / static_cast<float>(texSize.y);
-                const float scale = std::min(scaleX, scaleY);
-                m_boardSprite.setScale({scale, scale});
-                m_boardSprite.setPosition({m_boardRect.position.x + m_boardRect.size.x / 2.f,
-                                           m_boardRect.position.y + m_boardRect.size.y / 2.f});
-            }
-        }
+        layoutBoardSprite();
 
         if (m_hasFont)
         {
@@ -274,9 +285,9 @@ namespace App
         const TutorialStep &step = m_steps[m_currentStep];
 
         if (step.speaker == TutorialStep::Speaker::Wizard)
-            m_backgroundSprite.setTexture(m_wizardBackgroundTexture, true);
+            m_backgroundSprite.setTexture(*m_wizardBackgroundTexture, true);
         else
-            m_backgroundSprite.setTexture(m_knightBackgroundTexture, true);
+            m_backgroundSprite.setTexture(*m_knightBackgroundTexture, true);
 
         if (m_hasFont)
         {
@@ -291,9 +302,13 @@ namespace App
                                       static_cast<float>(size.y) / 2.f});
 
         if (!step.boardImagePath.empty())
-            loadBoardImage(step.boardImagePath);
+            showBoardImage(step.boardImagePath);
         else
+        {
+            m_boardPath.clear();
             m_hasBoardImage = false;
+        }
+        prefetchBoardImages();
 
         updateDialogueText();
     }
@@ -317,27 +332,112 @@ namespace App
             Audio::SfxManager::instance().play(Audio::SfxId::TutorialNextDialog);
     }
 
-    // Load the board screenshot for the current step. #
-    bool HowToPlayScreen::loadBoardImage(const std::string &path)
+    // Show a board image at once if uploaded; otherwise hide the board until its decode lands. #
+    void HowToPlayScreen::showBoardImage(const std::string &path)
     {
-        if (path == m_loadedBoardPath && m_hasBoardImage)
-            return true;
+        m_boardPath = path;
+        requestBoardImage(path);
 
-        if (!m_boardTexture.loadFromFile(path))
+        const auto found = m_boardTextures.find(path);
+        if (found == m_boardTextures.end() || !found->second)
         {
-            std::cerr << "Failed to load tutorial board image: " << path << "\n";
             m_hasBoardImage = false;
-            m_loadedBoardPath.clear();
-            return false;
+            return;
         }
 
-        m_boardSprite.setTexture(m_boardTexture, true);
-        const sf::Vector2u size = m_boardTexture.getSize();
+        const sf::Texture &texture = *found->second;
+        m_boardSprite.setTexture(texture, true);
+        const sf::Vector2u size = texture.getSize();
         m_boardSprite.setOrigin({static_cast<float>(size.x) / 2.f,
                                  static_cast<float>(size.y) / 2.f});
-        m_loadedBoardPath = path;
         m_hasBoardImage = true;
-        return true;
+        layoutBoardSprite();
+    }
+
+    // Decode a board image on a worker thread unless it is uploaded or already decoding. #
+    void HowToPlayScreen::requestBoardImage(const std::string &path)
+    {
+        if (path.empty() || m_boardTextures.count(path) > 0 || m_pendingBoards.count(path) > 0)
+            return;
+
+        m_pendingBoards.emplace(path, std::async(std::launch::async, [path]()
+                                                 {
+                                                     auto image = std::make_shared<sf::Image>();
+                                                     if (!image->loadFromFile(path))
+                                                         image.reset();
+                                                     return image; }));
+    }
+
+    // Request the next distinct board images after the current step. #
+    void HowToPlayScreen::prefetchBoardImages()
+    {
+        std::vector<const std::string *> upcoming;
+        for (std::size_t i = m_currentStep + 1; i < m_steps.size() && upcoming.size() < PREFETCH_IMAGES; ++i)
+        {
+            const std::string &path = m_steps[i].boardImagePath;
+            if (path.empty() || path == m_boardPath)
+                continue;
+            if (std::find_if(upcoming.begin(), upcoming.end(), [&](const std::string *seen)
+                             { return *seen == path; }) == upcoming.end())
+                upcoming.push_back(&path);
+        }
+        for (const std::string *path : upcoming)
+            requestBoardImage(*path);
+    }
+
+    // Upload finished decodes (GPU work stays on the UI thread) and swap in the one being waited for. #
+    void HowToPlayScreen::collectBoardImages()
+    {
+        for (auto it = m_pendingBoards.begin(); it != m_pendingBoards.end();)
+        {
+            if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++it;
+                continue;
+            }
+
+            const std::shared_ptr<sf::Image> image = it->second.get();
+            std::shared_ptr<sf::Texture> texture;
+            if (image)
+            {
+                texture = std::make_shared<sf::Texture>();
+                if (!texture->loadFromImage(*image))
+                    texture.reset();
+            }
+            if (!texture)
+                std::cerr << "Failed to load tutorial board image: " << it->first << "\n";
+
+            const std::string path = it->first;
+            m_boardTextures[path] = std::move(texture);
+            it = m_pendingBoards.erase(it);
+
+            if (path == m_boardPath && !m_hasBoardImage)
+            {
+                showBoardImage(path);
+                invalidate();
+            }
+        }
+
+        if (!m_pendingBoards.empty())
+            scheduleWake(INDICATOR_FRAME_TIME);
+    }
+
+    // Fit the board sprite inside the board rect, centered. #
+    void HowToPlayScreen::layoutBoardSprite()
+    {
+        if (!m_hasBoardImage)
+            return;
+
+        const sf::Vector2u texSize = m_boardSprite.getTexture().getSize();
+        if (texSize.x == 0 || texSize.y == 0)
+            return;
+
+        const float scaleX = m_boardRect.size.x / static_cast<float>(texSize.x);
+        const float scaleY = m_boardRect.size.y / static_cast<float>(texSize.y);
+        const float scale = std::min(scaleX, scaleY);
+        m_boardSprite.setScale({scale, scale});
+        m_boardSprite.setPosition({m_boardRect.position.x + m_boardRect.size.x / 2.f,
+                                   m_boardRect.position.y + m_boardRect.size.y / 2.f});
     }
 
     // Rewrap and update dialogue text for the layout. #
@@ -348,7 +448,7 @@ namespace App
 
         const float maxWidth = std::max(0.f, m_dialogueRect.size.x - DIALOGUE_PADDING * 2.f);
         const std::string wrapped = wrapText(m_steps[m_currentStep].text,
-                                             m_font,
+                                             *m_font,
                                              m_dialogueText.getCharacterSize(),
                                              maxWidth);
         m_dialogueText.setString(wrapped);
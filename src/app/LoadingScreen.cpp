@@ -0,0 +1,103 @@
+#include "app/LoadingScreen.hpp"
+#include "ui/ViewUtils.hpp"
+#include <iostream>
+
+namespace App
+{
+    static constexpr unsigned int LABEL_FONT_SIZE = 40;
+    static constexpr float LABEL_GAP = 32.f;
+    static const char *FONT_PATH = "assets/fonts/pixelon.ttf";
+
+    // Build the label and bar bound to the placeholder font until init. #
+    LoadingScreen::LoadingScreen(UI::AssetLoader &loader)
+        : m_loader(loader),
+          m_label(UI::ResourceCache::emptyFont())
+    {
+        m_barFrame.setSize(BAR_SIZE);
+        m_barFrame.setFillColor(sf::Color::Transparent);
+        m_barFrame.setOutlineColor(sf::Color::White);
+        m_barFrame.setOutlineThickness(2.f);
+        m_barFill.setFillColor(sf::Color::White);
+    }
+
+    // Load the font; fonts open lazily, so this does not wait on the workers. #
+    bool LoadingScreen::init()
+    {
+        m_font = UI::ResourceCache::instance().font(FONT_PATH);
+        if (!m_font)
+        {
+            std::cerr << "Failed to load font for loading screen\n";
+            return false;
+        }
+        m_label.setFont(*m_font);
+        m_label.setString("LOADING");
+        m_label.setCharacterSize(LABEL_FONT_SIZE);
+        m_label.setFillColor(sf::Color::White);
+        const sf::FloatRect bounds = m_label.getLocalBounds();
+        m_label.setOrigin({bounds.position.x + bounds.size.x / 2.f, bounds.position.y + bounds.size.y / 2.f});
+        return true;
+    }
+
+    // Register the callback run once every asset is collected. #
+    void LoadingScreen::setOnFinished(std::function<void()> onFinished)
+    {
+        m_onFinished = std::move(onFinished);
+    }
+
+    // Input is ignored while loading. #
+    void LoadingScreen::handleEvent(const sf::Event & /*event*/, sf::RenderWindow & /*window*/)
+    {
+    }
+
+    // Center the label and bar in the letterboxed UI view. #
+    void LoadingScreen::handleResize(sf::RenderWindow &window, sf::Vector2u /*size*/)
+    {
+        m_view = UI::makeLetterboxView(window.getSize());
+        const sf::Vector2f center = m_view.getCenter();
+        m_label.setPosition({center.x, center.y - LABEL_GAP - BAR_SIZE.y / 2.f});
+        m_barFrame.setPosition({center.x - BAR_SIZE.x / 2.f, center.y});
+        m_barFill.setPosition(m_barFrame.getPosition());
+        updateProgressBar();
+    }
+
+    // Hand finished assets to the cache and report completion once. #
+    void LoadingScreen::update(float /*dt*/)
+    {
+        if (m_finished)
+            return;
+
+        if (m_loader.collect() > 0)
+        {
+            updateProgressBar();
+            invalidate();
+        }
+
+        if (!m_loader.isDone())
+        {
+            scheduleWake(POLL_INTERVAL);
+            return;
+        }
+
+        m_finished = true;
+        if (m_onFinished)
+            m_onFinished();
+    }
+
+    // Draw the label and progress bar. #
+    void LoadingScreen::render(sf::RenderWindow &window)
+    {
+        window.setView(m_view);
+        window.draw(m_label);
+        window.draw(m_barFrame);
+        window.draw(m_barFill);
+    }
+
+    // Resize the fill to the collected share of the queue. #
+    void LoadingScreen::updateProgressBar()
+    {
+        const float progress = m_loader.total() == 0
+                                   ? 1.f
+                                   : static_cast<float>(m_loader.collected()) / static_cast<float>(m_loader.total());
+        m_barFill.setSize({BAR_SIZE.x * progress, BAR_SIZE.y});
+    }
+}
@@ -15,7 +15,7 @@ namespace App
 
     // Build menu sprites and gradient geometry. #
     MenuScreen::MenuScreen()
-        : m_backgroundSprite(m_backgroundTexture),
+        : m_backgroundSprite(UI::ResourceCache::emptyTexture()),
           m_menuGradient(sf::PrimitiveType::TriangleStrip, 8)
     {
     }
@@ -23,18 +23,21 @@ namespace App
     // Load background, font, and menu options. #
     bool MenuScreen::init()
     {
-        if (!m_backgroundTexture.loadFromFile("assets/textures/quoridor-bg-sprite-sheet.png"))
+        UI::ResourceCache &cache = UI::ResourceCache::instance();
+        m_backgroundTexture = cache.texture("assets/textures/quoridor-bg-sprite-sheet.png");
+        if (!m_backgroundTexture)
         {
             std::cerr << "Failed to load menu background\n";
             return false;
         }
 
-        m_backgroundSprite.setTexture(m_backgroundTexture, true);
+        m_backgroundSprite.setTexture(*m_backgroundTexture, true);
         m_backgroundSprite.setTextureRect(
             sf::IntRect({0, 0}, {FRAME_WIDTH, FRAME_HEIGHT}));
         m_backgroundSprite.setOrigin({FRAME_WIDTH / 2.f, FRAME_HEIGHT / 2.f});
 
-        if (!m_font.openFromFile("assets/fonts/pixelon.ttf"))
+        m_font = cache.font("assets/fonts/pixelon.ttf");
+        if (!m_font)
         {
             std::cerr << "Failed to load font for menu screen (cwd: "
                       << std::filesystem::current_path().string() << ")\n";
@@ -55,7 +58,7 @@ namespace App
         m_optionTexts.reserve(m_options.size());
         for (const char *label : labels)
         {
-            sf::Text text(m_font);
+            sf::Text text(*m_font);
             text.setString(label);
             text.setFillColor(sf::Color::White);
             text.setCharacterSize(MENU_FONT_SIZE);
@@ -148,6 +151,8 @@ namespace App
         m_blinkTimer += dt;
         const float pulse = (std::sin(m_blinkTimer * 3.5f) + 1.f) * 0.5f;
         const std::uint8_t alpha = static_cast<std::uint8_t>(120 + pulse * 135);
+        if (m_selectedIndex < m_optionTexts.size() && m_optionTexts[m_selectedIndex].getFillColor().a != alpha)
+            invalidate();
         applyOptionColors(alpha);
 
         m_frameTimer += dt;
@@ -162,7 +167,10 @@ namespace App
             m_backgroundSprite.setTextureRect(
                 sf::IntRect({col * FRAME_WIDTH, row * FRAME_HEIGHT},
                             {FRAME_WIDTH, FRAME_HEIGHT}));
+            invalidate();
         }
+        // The option blink follows the sprite-sheet cadence, so one wake-up serves both.
+        scheduleWake(FRAME_TIME - m_frameTimer);
     }
 
     // Draw background, gradient, and menu options. #
@@ -204,7 +212,7 @@ namespace App
                             bounds.position.y + bounds.size.y / 2.f});
         }
 
-        const float lineSpacing = m_font.getLineSpacing(textSize);
+        const float lineSpacing = m_font->getLineSpacing(textSize);
         const float totalHeight = lineSpacing * static_cast<float>(m_optionTexts.size());
         const float padding = 18.f * textScale;
         const sf::Vector2f containerSize{672.f * textScale,
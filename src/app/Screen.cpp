@@ -1,5 +1,6 @@
 #include "app/Screen.hpp"
 #include <SFML/Audio.hpp>
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <unordered_set>
@@ -94,4 +95,25 @@ namespace App
         state.music.setVolume(DEFAULT_MUSIC_VOLUME);
         state.music.play();
     }
+
+    // Drop the previous wake request, then let the screen schedule a new one. #
+    void Screen::tick(float dt)
+    {
+        m_wakeDelay = -1.f;
+        update(dt);
+    }
+
+    // Mark the presented frame as stale. #
+    void Screen::invalidate()
+    {
+        m_needsRedraw = true;
+    }
+
+    // Keep the earliest wake request of this update. #
+    void Screen::scheduleWake(float seconds)
+    {
+        seconds = std::max(0.f, seconds);
+        if (m_wakeDelay < 0.f || seconds < m_wakeDelay)
+            m_wakeDelay = seconds;
+    }
 }
@@ -15,9 +15,9 @@ namespace App
 
     // Build title screen sprites and gradient geometry. #
     TitleScreen::TitleScreen()
-        : m_backgroundSprite(m_backgroundTexture),
-          m_promptLine1(m_font),
-          m_promptLine2(m_font),
+        : m_backgroundSprite(UI::ResourceCache::emptyTexture()),
+          m_promptLine1(UI::ResourceCache::emptyFont()),
+          m_promptLine2(UI::ResourceCache::emptyFont()),
           m_promptGradient(sf::PrimitiveType::TriangleStrip, 8)
     {
     }
@@ -25,30 +25,33 @@ namespace App
     // Load background, font, and prompt text. #
     bool TitleScreen::init()
     {
-        if (!m_backgroundTexture.loadFromFile("assets/textures/quoridor-bg-sprite-sheet.png"))
+        UI::ResourceCache &cache = UI::ResourceCache::instance();
+        m_backgroundTexture = cache.texture("assets/textures/quoridor-bg-sprite-sheet.png");
+        if (!m_backgroundTexture)
         {
             std::cerr << "Failed to load title background\n";
             return false;
         }
 
-        m_backgroundSprite.setTexture(m_backgroundTexture, true);
+        m_backgroundSprite.setTexture(*m_backgroundTexture, true);
         m_backgroundSprite.setTextureRect(
             sf::IntRect({0, 0}, {FRAME_WIDTH, FRAME_HEIGHT}));
         m_backgroundSprite.setOrigin({FRAME_WIDTH / 2.f, FRAME_HEIGHT / 2.f});
 
-        if (!m_font.openFromFile("assets/fonts/pixelon.ttf"))
+        m_font = cache.font("assets/fonts/pixelon.ttf");
+        if (!m_font)
         {
             std::cerr << "Failed to load font for title screen (cwd: "
                       << std::filesystem::current_path().string() << ")\n";
             return false;
         }
 
-        m_promptLine1.setFont(m_font);
+        m_promptLine1.setFont(*m_font);
         m_promptLine1.setString("PLEASE PRESS ANY KEY");
         m_promptLine1.setFillColor(sf::Color::White);
         m_promptLine1.setCharacterSize(PROMPT_FONT_SIZE);
 
-        m_promptLine2.setFont(m_font);
+        m_promptLine2.setFont(*m_font);
         m_promptLine2.setString("TO START");
         m_promptLine2.setFillColor(PROMPT_ACCENT_COLOR);
         m_promptLine2.setCharacterSize(PROMPT_FONT_SIZE);
@@ -85,6 +88,8 @@ namespace App
         const float pulse = (std::sin(m_blinkTimer * 3.5f) + 1.f) * 0.5f;
         const std::uint8_t alpha = static_cast<std::uint8_t>(120 + pulse * 135);
         sf::Color color1 = m_promptLine1.getFillColor();
+        if (color1.a != alpha)
+            invalidate();
         color1.a = alpha;
         m_promptLine1.setFillColor(color1);
 
@@ -104,7 +109,10 @@ namespace App
             m_backgroundSprite.setTextureRect(
                 sf::IntRect({col * FRAME_WIDTH, row * FRAME_HEIGHT},
                             {FRAME_WIDTH, FRAME_HEIGHT}));
+            invalidate();
         }
+        // The prompt blink follows the sprite-sheet cadence, so one wake-up serves both.
+        scheduleWake(FRAME_TIME - m_frameTimer);
     }
 
     // Draw background and blinking prompt. #
@@ -151,7 +159,7 @@ namespace App
         const sf::Vector2f containerSize{672.f * textScale, 125.f * textScale};
         const sf::Vector2f containerCenter{viewCenter.x, viewCenter.y + viewSize.y * 0.12f};
 
-        const float lineSpacing = m_font.getLineSpacing(textSize);
+        const float lineSpacing = m_font->getLineSpacing(textSize);
         const float totalHeight = lineSpacing * 2.f;
         const float line1Y = containerCenter.y - totalHeight / 2.f + lineSpacing / 2.f;
         const float line2Y = line1Y + lineSpacing;
@@ -1,4 +1,5 @@
 #include "audio/SfxManager.hpp"
+#include "ui/ResourceCache.hpp"
 #include <algorithm>
 #include <iostream>
 
@@ -23,6 +24,9 @@ namespace Audio
         m_paths[indexFromId(SfxId::MenuOpen)] = "assets/sound/click.mp3";
         m_pool.reserve(kMaxPool);
         m_poolScales.reserve(kMaxPool);
+        m_voiceEnds.reserve(kMaxPool);
+        m_freeVoices.reserve(kMaxPool);
+        m_busyVoices.reserve(kMaxPool);
         m_volumeScales.fill(1.f);
         m_volumeScales[indexFromId(SfxId::Hover)] = 0.20f;
         m_volumeScales[indexFromId(SfxId::Wall)] = 2.f;
@@ -39,8 +43,9 @@ namespace Audio
             return;
 
         const float volumeScale = m_volumeScales[indexFromId(id)];
-        sf::Sound &sound = acquireSound(m_buffers[indexFromId(id)], volumeScale);
-        sound.setBuffer(m_buffers[indexFromId(id)]);
+        const sf::SoundBuffer &buffer = *m_buffers[indexFromId(id)];
+        sf::Sound &sound = acquireSound(buffer, volumeScale);
+        sound.setBuffer(buffer);
         sound.setVolume(volumeFromScale(volumeScale));
         sound.play();
     }
@@ -54,6 +59,18 @@ namespace Audio
         }
     }
 
+    // List each sound file once, in id order. #
+    std::vector<std::string> SfxManager::assetPaths() const
+    {
+        std::vector<std::string> paths;
+        for (const std::string &path : m_paths)
+        {
+            if (!path.empty() && std::find(paths.begin(), paths.end(), path) == paths.end())
+                paths.push_back(path);
+        }
+        return paths;
+    }
+
     // Clamp and apply the master SFX volume across active sounds. #
     void SfxManager::setSfxVolume(float volume)
     {
@@ -84,7 +101,7 @@ namespace Audio
     bool SfxManager::loadBuffer(SfxId id)
     {
         const std::size_t index = indexFromId(id);
-        if (m_loaded[index])
+        if (m_buffers[index])
             return true;
         if (m_failed[index])
             return false;
@@ -97,14 +114,14 @@ namespace Audio
             return false;
         }
 
-        if (!m_buffers[index].loadFromFile(path))
+        m_buffers[index] = UI::ResourceCache::instance().soundBuffer(path);
+        if (!m_buffers[index])
         {
             std::cerr << "Failed to load SFX: " << path << "\n";
             m_failed[index] = true;
             return false;
         }
 
-        m_loaded[index] = true;
         return true;
     }
 
@@ -116,30 +133,60 @@ namespace Audio
         return std::max(0.f, std::min(m_volume * scale, 100.f));
     }
 
-    // Reuse a stopped sound or rotate through the pool when full. #
+    // Pick a voice without polling the audio device: free list, then growth, then the voice ending first. #
     sf::Sound &SfxManager::acquireSound(const sf::SoundBuffer &buffer, float volumeScale)
     {
-        for (std::size_t i = 0; i < m_pool.size(); ++i)
+        const double now = m_clock.getElapsedTime().asSeconds();
+        reclaimFinished(now);
+
+        std::size_t voice = 0;
+        if (!m_freeVoices.empty())
         {
-            if (m_pool[i].getStatus() == sf::SoundSource::Status::Stopped)
-            {
-                m_poolScales[i] = volumeScale;
-                return m_pool[i];
-            }
+            voice = m_freeVoices.back();
+            m_freeVoices.pop_back();
         }
-
-        if (m_pool.size() < kMaxPool)
+        else if (m_pool.size() < kMaxPool)
         {
+            voice = m_pool.size();
             m_pool.emplace_back(buffer);
             m_poolScales.push_back(volumeScale);
-            return m_pool.back();
+            m_voiceEnds.push_back(0.0);
+        }
+        else
+        {
+            voice = popBusy();
+            m_pool[voice].stop();
         }
 
-        sf::Sound &sound = m_pool[m_nextIndex];
-        m_poolScales[m_nextIndex] = volumeScale;
-        m_nextIndex = (m_nextIndex + 1) % m_pool.size();
-        sound.stop();
-        return sound;
+        m_poolScales[voice] = volumeScale;
+        m_voiceEnds[voice] = now + buffer.getDuration().asSeconds();
+        pushBusy(voice);
+        return m_pool[voice];
+    }
+
+    // Free every voice whose buffer has played out, whatever order the sounds started in. #
+    void SfxManager::reclaimFinished(double now)
+    {
+        while (!m_busyVoices.empty() && m_voiceEnds[m_busyVoices.front()] <= now)
+            m_freeVoices.push_back(popBusy());
+    }
+
+    // Insert a voice keyed on its end time; O(log kMaxPool). #
+    void SfxManager::pushBusy(std::size_t voice)
+    {
+        m_busyVoices.push_back(voice);
+        std::push_heap(m_busyVoices.begin(), m_busyVoices.end(), [this](std::size_t a, std::size_t b)
+                       { return m_voiceEnds[a] > m_voiceEnds[b]; });
+    }
+
+    // Take the voice with the earliest end time off the heap. #
+    std::size_t SfxManager::popBusy()
+    {
+        std::pop_heap(m_busyVoices.begin(), m_busyVoices.end(), [this](std::size_t a, std::size_t b)
+                      { return m_voiceEnds[a] > m_voiceEnds[b]; });
+        const std::size_t voice = m_busyVoices.back();
+        m_busyVoices.pop_back();
+        return voice;
     }
 
     // Apply current volume settings to every pooled sound. #
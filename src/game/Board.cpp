@@ -1,5 +1,7 @@
 #include "game/Board.hpp"
 #include "game/GameState.hpp"
+#include "game/Move.hpp"
+#include "ui/Profiler.hpp"
 #include <algorithm>
 #include <iostream>
 #include <stdexcept>
@@ -10,7 +12,7 @@ namespace Game
 
     // Construct board and initialize default state. #
     Board::Board()
-        : m_backgroundSprite(m_backgroundTexture)
+        : m_backgroundSprite(UI::ResourceCache::emptyTexture())
     {
         init();
     }
@@ -28,18 +30,20 @@ namespace Game
             }
         }
         m_walls.clear();
+        ++m_revision;
 
         if (loadVisuals && !m_hasBackground)
         {
-            if (!m_backgroundTexture.loadFromFile("assets/textures/bg.png"))
+            m_backgroundTexture = UI::ResourceCache::instance().texture("assets/textures/bg.png");
+            if (!m_backgroundTexture)
             {
                 std::cerr << "Error: Could not load bg.png\n";
                 m_hasBackground = false;
             }
             else
             {
-                m_backgroundSprite.setTexture(m_backgroundTexture, true);
-                sf::Vector2u texSize = m_backgroundTexture.getSize();
+                m_backgroundSprite.setTexture(*m_backgroundTexture, true);
+                sf::Vector2u texSize = m_backgroundTexture->getSize();
                 m_backgroundSprite.setOrigin({float(texSize.x) / 2.f, float(texSize.y) / 2.f});
                 m_backgroundSprite.setPosition({0.f, 0.f});
                 m_hasBackground = true;
@@ -76,11 +80,13 @@ namespace Game
         m_pawns.clear();
         m_pawns.emplace_back(1, p1x, p1y);
         m_pawns.emplace_back(2, p2x, p2y);
+        ++m_revision;
     }
 
-    // Rebuild board content from a GameState snapshot. #
+    // Rebuild board content from a GameState snapshot (walls come from a legal state, so no revalidation). #
     bool Board::loadFromState(const GameState &state)
     {
+        UI::ProfileScope zone("Board::loadFromState");
         init(false);
         setPawns(state.pawnX[0], state.pawnY[0], state.pawnX[1], state.pawnY[1]);
 
@@ -88,22 +94,30 @@ namespace Game
         {
             for (int x = 0; x < GameState::WALL_GRID; ++x)
             {
-                if (state.hWalls[x][y])
-                {
-                    if (!placeWall(x, y, Orientation::Horizontal))
-                        return false;
-                }
-                if (state.vWalls[x][y])
-                {
-                    if (!placeWall(x, y, Orientation::Vertical))
-                        return false;
-                }
+                if (state.hWalls[x][y] && !addWall(x, y, Orientation::Horizontal))
+                    return false;
+                if (state.vWalls[x][y] && !addWall(x, y, Orientation::Vertical))
+                    return false;
             }
         }
 
         return true;
     }
 
+    // Apply the delta of a move that GameRules already applied to the state. #
+    bool Board::applyMove(const Move &move)
+    {
+        if (move.type() == MoveType::WallPlacement)
+            return addWall(move.x(), move.y(), move.orientation());
+
+        Pawn *pawn = getPawnById(move.playerId());
+        if (!pawn || !isValid(move.x(), move.y()))
+            return false;
+        pawn->setPosition(move.x(), move.y());
+        ++m_revision;
+        return true;
+    }
+
     // Draw the board background with letterbox scaling. #
     void Board::drawBackground(sf::RenderWindow &window) const
     {
@@ -114,7 +128,7 @@ namespace Game
         const sf::View view = window.getView();
         const sf::Vector2f viewSize = view.getSize();
         const sf::Vector2f viewCenter = view.getCenter();
-        const sf::Vector2u texSize = m_backgroundTexture.getSize();
+        const sf::Vector2u texSize = m_backgroundTexture->getSize();
         if (texSize.x == 0 || texSize.y == 0)
             return;
 
@@ -169,10 +183,20 @@ namespace Game
         if (!tempWall.isValidMove(*this, x, y))
             return false;
 
+        return addWall(x, y, orientation);
+    }
+    // Block the edges and add the wall sprite without the O(walls) legality check. #
+    bool Board::addWall(int x, int y, Orientation orientation)
+    {
+        if (x < 0 || x >= GameState::WALL_GRID || y < 0 || y >= GameState::WALL_GRID)
+            return false;
+
         toggleWall(x, y, orientation, true);
         m_walls.emplace_back(x, y, orientation);
+        ++m_revision;
         return true;
     }
+
     // Apply or remove wall blocking on affected edges. #
     void Board::toggleWall(int x, int y, Orientation ori, bool blocking)
     {
@@ -223,6 +247,7 @@ namespace Game
         if (pawn->isValidMove(*this, targetX, targetY))
         {
             pawn->setPosition(targetX, targetY);
+            ++m_revision;
             return true;
         }
         return false;
@@ -234,5 +259,11 @@ namespace Game
         return x >= 0 && x < SIZE && y >= 0 && y < SIZE;
     }
 
+    // Return the change counter (renderers rebuild cached draw data when it moves). #
+    std::uint64_t Board::revision() const
+    {
+        return m_revision;
+    }
+
     // Win condition now lives in GameState.
 }
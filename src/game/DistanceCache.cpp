@@ -0,0 +1,142 @@
+#include "game/DistanceCache.hpp"
+#include "game/GameRules.hpp"
+
+#include <cstring>
+
+namespace Game
+{
+    namespace
+    {
+        // Gather the low bit of each of 8 bytes into one byte. #
+        uint64_t packBytes(uint64_t bytes)
+        {
+            return (bytes * 0x0102040810204080ULL) >> 56;
+        }
+
+        // Pack a 0/1 wall grid into 64 bits (8 bytes at a time). #
+        uint64_t packGrid(const uint8_t grid[GameState::WALL_GRID][GameState::WALL_GRID])
+        {
+            uint64_t bits = 0;
+            for (int x = 0; x < GameState::WALL_GRID; ++x)
+            {
+                uint64_t column = 0;
+                std::memcpy(&column, grid[x], sizeof(column));
+                bits |= packBytes(column & 0x0101010101010101ULL) << (8 * x);
+            }
+            return bits;
+        }
+
+        // Mix the wall key into a slot index. #
+        size_t slotFor(const WallSetKey &key)
+        {
+            uint64_t h = key.hWalls ^ (key.vWalls * 0x9E3779B97F4A7C15ULL) ^ (key.seats << 61);
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDULL;
+            h ^= h >> 33;
+            return static_cast<size_t>(h);
+        }
+    }
+
+    // Access the shared cache. #
+    DistanceCache &DistanceCache::instance()
+    {
+        static DistanceCache cache;
+        return cache;
+    }
+
+    // Allocate empty slots. #
+    DistanceCache::DistanceCache()
+        : m_entries(new Entry[ENTRIES])
+    {
+    }
+
+    // Build the exact wall key of a state. #
+    WallSetKey DistanceCache::keyFor(const GameState &state)
+    {
+        WallSetKey key;
+        key.hWalls = packGrid(state.hWalls);
+        key.vWalls = packGrid(state.vWalls);
+        key.seats = static_cast<uint64_t>(playerCount(state));
+        return key;
+    }
+
+    // Copy grids for a wall layout if a consistent entry is present. #
+    bool DistanceCache::probe(const WallSetKey &key,
+                              int16_t grids[][GameState::BOARD_SIZE][GameState::BOARD_SIZE]) const
+    {
+        const Entry &entry = m_entries[slotFor(key) & (ENTRIES - 1)];
+
+        const uint64_t before = entry.sequence.load(std::memory_order_acquire);
+        if (before & 1)
+            return false;
+        if (entry.seats.load(std::memory_order_relaxed) != key.seats ||
+            entry.hWalls.load(std::memory_order_relaxed) != key.hWalls ||
+            entry.vWalls.load(std::memory_order_relaxed) != key.vWalls)
+            return false;
+
+        const int bytes = static_cast<int>(key.seats) * CELLS;
+        const int words = (bytes + 7) / 8;
+        uint64_t packed[WORDS];
+        for (int i = 0; i < words; ++i)
+            packed[i] = entry.distances[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry.sequence.load(std::memory_order_relaxed) != before)
+            return false;
+
+        int8_t cells[WORDS * 8];
+        std::memcpy(cells, packed, sizeof(cells));
+        for (int p = 0; p < static_cast<int>(key.seats); ++p)
+        {
+            for (int i = 0; i < CELLS; ++i)
+                grids[p][i / GameState::BOARD_SIZE][i % GameState::BOARD_SIZE] = cells[p * CELLS + i];
+        }
+        return true;
+    }
+
+    // Publish grids for a wall layout; skipped if another writer owns the slot. #
+    void DistanceCache::store(const WallSetKey &key,
+                              const int16_t grids[][GameState::BOARD_SIZE][GameState::BOARD_SIZE])
+    {
+        Entry &entry = m_entries[slotFor(key) & (ENTRIES - 1)];
+
+        uint64_t sequence = entry.sequence.load(std::memory_order_relaxed);
+        if ((sequence & 1) ||
+            !entry.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire))
+            return;
+
+        // Distances never exceed 80 steps, so one signed byte per cell is exact.
+        int8_t cells[WORDS * 8] = {};
+        for (int p = 0; p < static_cast<int>(key.seats); ++p)
+        {
+            for (int i = 0; i < CELLS; ++i)
+                cells[p * CELLS + i] = static_cast<int8_t>(grids[p][i / GameState::BOARD_SIZE][i % GameState::BOARD_SIZE]);
+        }
+        uint64_t packed[WORDS];
+        std::memcpy(packed, cells, sizeof(packed));
+
+        entry.hWalls.store(key.hWalls, std::memory_order_relaxed);
+        entry.vWalls.store(key.vWalls, std::memory_order_relaxed);
+        entry.seats.store(key.seats, std::memory_order_relaxed);
+        const int words = (static_cast<int>(key.seats) * CELLS + 7) / 8;
+        for (int i = 0; i < words; ++i)
+            entry.distances[i].store(packed[i], std::memory_order_relaxed);
+
+        entry.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Mark every slot empty, using the same claim/publish protocol as writers. #
+    void DistanceCache::clear()
+    {
+        for (size_t i = 0; i < ENTRIES; ++i)
+        {
+            Entry &entry = m_entries[i];
+            uint64_t sequence = entry.sequence.load(std::memory_order_relaxed);
+            if ((sequence & 1) ||
+                !entry.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire))
+                continue;
+            entry.seats.store(0, std::memory_order_relaxed);
+            entry.sequence.store(sequence + 2, std::memory_order_release);
+        }
+    }
+}
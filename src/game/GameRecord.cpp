@@ -0,0 +1,289 @@
+#include "game/GameRecord.hpp"
+#include "game/GameRules.hpp"
+#include "game/Notation.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace Game
+{
+    namespace
+    {
+        // Check whether a state is the standard opening position. #
+        bool isStandardStart(const GameState &state)
+        {
+            GameState initial{};
+            initGameState(initial, playerCount(state));
+            return positionToText(initial) == positionToText(state);
+        }
+
+        // Check whether a token is a result marker. #
+        bool isResultToken(const std::string &token)
+        {
+            if (token == "*")
+                return true;
+            for (char c : token)
+            {
+                if (c != '0' && c != '1' && c != '-')
+                    return false;
+            }
+            return token.find('-') != std::string::npos;
+        }
+
+        // Read "key value" pairs from a move comment body. #
+        void parseComment(const std::string &body, RecordedMove &move)
+        {
+            std::istringstream in(body);
+            std::string key;
+            while (in >> key)
+            {
+                long long value = 0;
+                if (!(in >> value))
+                    break;
+                if (key == "score")
+                    move.score = static_cast<int>(value);
+                else if (key == "depth")
+                    move.depth = static_cast<int>(value);
+                else if (key == "nodes")
+                    move.nodes = value;
+                else if (key == "time")
+                    move.timeMs = static_cast<int>(value);
+                else
+                    continue;
+                move.searched = true;
+            }
+        }
+    }
+
+    // Format the result of a state for the record footer. #
+    std::string resultText(const GameState &state)
+    {
+        const int winnerId = winner(state);
+        if (winnerId == 0)
+            return "*";
+
+        std::string text;
+        for (int id = 1; id <= playerCount(state); ++id)
+        {
+            if (id > 1)
+                text.push_back('-');
+            text.push_back(id == winnerId ? '1' : '0');
+        }
+        return text;
+    }
+
+    // Start an empty record at the given position. #
+    void GameRecord::reset(const GameState &start)
+    {
+        m_start = start;
+        m_moves.clear();
+        m_tags.clear();
+    }
+
+    // Set a header tag, keeping first-insertion order. #
+    void GameRecord::setTag(const std::string &name, const std::string &value)
+    {
+        for (auto &entry : m_tags)
+        {
+            if (entry.first == name)
+            {
+                entry.second = value;
+                return;
+            }
+        }
+        m_tags.emplace_back(name, value);
+    }
+
+    // Read a header tag value. #
+    std::string GameRecord::tag(const std::string &name) const
+    {
+        for (const auto &entry : m_tags)
+        {
+            if (entry.first == name)
+                return entry.second;
+        }
+        return {};
+    }
+
+    // Append a ply to the record. #
+    void GameRecord::addMove(const RecordedMove &move)
+    {
+        m_moves.push_back(move);
+    }
+
+    // Access the starting position. #
+    const GameState &GameRecord::start() const
+    {
+        return m_start;
+    }
+
+    // Access the recorded plies. #
+    const std::vector<RecordedMove> &GameRecord::moves() const
+    {
+        return m_moves;
+    }
+
+    // Check whether any ply was recorded. #
+    bool GameRecord::empty() const
+    {
+        return m_moves.empty();
+    }
+
+    // Serialize headers, numbered moves with engine comments, and the result. #
+    std::string GameRecord::toText() const
+    {
+        std::ostringstream out;
+        GameState state = m_start;
+
+        for (const auto &entry : m_tags)
+        {
+            if (entry.first != "Position" && entry.first != "Result")
+                out << '[' << entry.first << " \"" << entry.second << "\"]\n";
+        }
+        if (!isStandardStart(m_start))
+            out << "[Position \"" << positionToText(m_start) << "\"]\n";
+
+        std::ostringstream body;
+        const int seats = playerCount(m_start);
+        int seatIndex = m_start.currentPlayerId - 1;
+        int moveNumber = 1;
+        bool lineStart = true;
+        for (const RecordedMove &ply : m_moves)
+        {
+            if (seatIndex == 0 || lineStart)
+            {
+                if (!lineStart)
+                    body << '\n';
+                body << moveNumber << '.';
+                if (seatIndex != 0)
+                    body << "..";
+                lineStart = false;
+            }
+
+            body << ' ' << moveToText(ply.move);
+            if (ply.searched)
+            {
+                body << " {score " << ply.score << " depth " << ply.depth << " nodes " << ply.nodes
+                     << " time " << ply.timeMs << '}';
+            }
+            applyMove(state, ply.move);
+
+            seatIndex = (seatIndex + 1) % seats;
+            if (seatIndex == 0)
+                ++moveNumber;
+        }
+
+        const std::string result = resultText(state);
+        out << "[Result \"" << result << "\"]\n\n";
+        out << body.str();
+        if (!m_moves.empty())
+            out << ' ';
+        out << result << '\n';
+        return out.str();
+    }
+
+    // Parse a record, replaying each move to validate it and assign player ids. #
+    bool GameRecord::fromText(const std::string &text)
+    {
+        GameRecord parsed;
+        initGameState(parsed.m_start);
+
+        std::istringstream lines(text);
+        std::string line;
+        std::string moveText;
+        while (std::getline(lines, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (!line.empty() && line[0] == '[')
+            {
+                const size_t space = line.find(' ');
+                const size_t open = line.find('"');
+                const size_t close = line.rfind('"');
+                if (space == std::string::npos || open == std::string::npos || close <= open)
+                    return false;
+                const std::string name = line.substr(1, space - 1);
+                const std::string value = line.substr(open + 1, close - open - 1);
+                if (name == "Position")
+                {
+                    if (!parsePosition(value, parsed.m_start))
+                        return false;
+                }
+                else if (name != "Result")
+                {
+                    parsed.setTag(name, value);
+                }
+                continue;
+            }
+            moveText += line;
+            moveText += '\n';
+        }
+
+        GameState state = parsed.m_start;
+        size_t pos = 0;
+        while (pos < moveText.size())
+        {
+            const char c = moveText[pos];
+            if (c == ' ' || c == '\n' || c == '\t')
+            {
+                ++pos;
+                continue;
+            }
+            if (c == '{')
+            {
+                const size_t end = moveText.find('}', pos);
+                if (end == std::string::npos || parsed.m_moves.empty())
+                    return false;
+                parseComment(moveText.substr(pos + 1, end - pos - 1), parsed.m_moves.back());
+                pos = end + 1;
+                continue;
+            }
+
+            size_t end = pos;
+            while (end < moveText.size() && moveText[end] != ' ' && moveText[end] != '\n' &&
+                   moveText[end] != '\t' && moveText[end] != '{')
+                ++end;
+            std::string token = moveText.substr(pos, end - pos);
+            pos = end;
+
+            if (isResultToken(token))
+                break;
+
+            // Strip a leading move number ("12." or "12...").
+            const size_t dot = token.rfind('.');
+            if (dot != std::string::npos)
+                token = token.substr(dot + 1);
+            if (token.empty())
+                continue;
+
+            RecordedMove ply;
+            if (!parseMove(token, currentPlayer(state), ply.move) || !applyMove(state, ply.move))
+                return false;
+            parsed.m_moves.push_back(ply);
+        }
+
+        *this = std::move(parsed);
+        return true;
+    }
+
+    // Write the record to a file. #
+    bool GameRecord::save(const std::string &path) const
+    {
+        std::ofstream out(path);
+        if (!out)
+            return false;
+        out << toText();
+        return static_cast<bool>(out);
+    }
+
+    // Read a record from a file. #
+    bool GameRecord::load(const std::string &path)
+    {
+        std::ifstream in(path);
+        if (!in)
+            return false;
+        std::ostringstream buffer;
+        buffer << in.rdbuf();
+        return fromText(buffer.str());
+    }
+}
@@ -1,9 +1,10 @@
 #include "game/GameRules.hpp"
+#include "game/DistanceCache.hpp"
 #include "game/WallRules.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
-#include <queue>
 #include <utility>
 
 namespace Game
@@ -11,21 +12,32 @@ namespace Game
     static_assert(GameState::WALL_GRID == WALL_GRID, "Wall grid size mismatch.");
 
     // Initialize a new game state with default positions and walls. #
-    void initGameState(GameState &state)
+    void initGameState(GameState &state, int playerCount)
     {
-        state.pawnX[0] = 4;
-        state.pawnY[0] = GameState::BOARD_SIZE - 1;
-        state.pawnX[1] = 4;
-        state.pawnY[1] = 0;
+        const int seats = (playerCount == 4) ? 4 : 2;
+        const int walls = (seats == 4) ? GameState::MAX_WALLS_PER_PLAYER_4P
+                                       : GameState::MAX_WALLS_PER_PLAYER;
+        const int mid = GameState::BOARD_SIZE / 2;
+        const int last = GameState::BOARD_SIZE - 1;
 
-        state.wallsRemaining[0] = GameState::MAX_WALLS_PER_PLAYER;
-        state.wallsRemaining[1] = GameState::MAX_WALLS_PER_PLAYER;
+        // Seats: 1 bottom, 2 top, 3 left, 4 right; each heads for the opposite side.
+        const uint8_t startX[GameState::MAX_PLAYERS] = {uint8_t(mid), uint8_t(mid), 0, uint8_t(last)};
+        const uint8_t startY[GameState::MAX_PLAYERS] = {uint8_t(last), 0, uint8_t(mid), uint8_t(mid)};
+
+        for (int i = 0; i < GameState::MAX_PLAYERS; ++i)
+        {
+            const bool seated = i < seats;
+            state.pawnX[i] = seated ? startX[i] : 0;
+            state.pawnY[i] = seated ? startY[i] : 0;
+            state.wallsRemaining[i] = seated ? static_cast<uint8_t>(walls) : 0;
+        }
 
         std::memset(state.hWalls, 0, sizeof(state.hWalls));
         std::memset(state.vWalls, 0, sizeof(state.vWalls));
         std::memset(state.distToGoal, 0xFF, sizeof(state.distToGoal));
         state.distDirty = 1;
 
+        state.playerCount = static_cast<uint8_t>(seats);
         state.currentPlayerId = 1;
         state.winnerId = 0;
     }
@@ -56,18 +68,22 @@ namespace Game
             return inBoundsWall(x, y) && state.vWalls[x][y] != 0;
         }
 
-        // Check if any pawn occupies the cell. #
-        bool isOccupied(const GameState &state, int x, int y)
+        // Check if a player id is seated in this game. #
+        bool isSeated(const GameState &state, int playerId)
         {
-            return (state.pawnX[0] == x && state.pawnY[0] == y) ||
-                   (state.pawnX[1] == x && state.pawnY[1] == y);
+            return playerId >= 1 && playerId <= playerCount(state);
         }
 
-        // Check if the opponent occupies a cell. #
-        bool isOpponentAt(const GameState &state, int playerId, int x, int y)
+        // Check if any pawn occupies the cell. #
+        bool isOccupied(const GameState &state, int x, int y)
         {
-            int opponentIdx = (playerId == 1) ? 1 : 0;
-            return state.pawnX[opponentIdx] == x && state.pawnY[opponentIdx] == y;
+            const int seats = playerCount(state);
+            for (int i = 0; i < seats; ++i)
+            {
+                if (state.pawnX[i] == x && state.pawnY[i] == y)
+                    return true;
+            }
+            return false;
         }
 
         // Check if movement between two cells is blocked by walls. #
@@ -95,135 +111,261 @@ namespace Game
 
             return true;
         }
-    }
 
-    // Return the current player id. #
-    int currentPlayer(const GameState &state) { return state.currentPlayerId; }
-    // Return the winner id (0 if none). #
-    int winner(const GameState &state) { return state.winnerId; }
-    // Check if the game has ended. #
-    bool isGameOver(const GameState &state) { return state.winnerId != 0; }
+        constexpr int kCells = GameState::BOARD_SIZE * GameState::BOARD_SIZE;
+        constexpr int kMaxPawnTargets = 8;
+        constexpr int kDirX[4] = {0, 1, 0, -1};
+        constexpr int kDirY[4] = {-1, 0, 1, 0};
 
-    // Compute shortest distances to the goal row. #
-    void computeDistancesToGoal(const GameState &state, int playerId,
-                                int16_t dist[GameState::BOARD_SIZE][GameState::BOARD_SIZE])
-    {
-        for (int y = 0; y < GameState::BOARD_SIZE; ++y)
+        struct NeighborTable // Adjacent cell per direction (-1 off the board) #
         {
-            for (int x = 0; x < GameState::BOARD_SIZE; ++x)
+            int8_t next[kCells][4];
+        };
+
+        // Build the per-cell neighbor table at compile time. #
+        constexpr NeighborTable buildNeighborTable()
+        {
+            NeighborTable table{};
+            for (int cell = 0; cell < kCells; ++cell)
             {
-                dist[y][x] = -1;
+                const int x = cell % GameState::BOARD_SIZE;
+                const int y = cell / GameState::BOARD_SIZE;
+                for (int dir = 0; dir < 4; ++dir)
+                {
+                    const int nx = x + kDirX[dir];
+                    const int ny = y + kDirY[dir];
+                    const bool inside = nx >= 0 && nx < GameState::BOARD_SIZE && ny >= 0 && ny < GameState::BOARD_SIZE;
+                    table.next[cell][dir] = static_cast<int8_t>(inside ? ny * GameState::BOARD_SIZE + nx : -1);
+                }
             }
+            return table;
         }
 
-        if (playerId != 1 && playerId != 2)
-            return;
-
-        int targetRow = (playerId == 1) ? 0 : GameState::BOARD_SIZE - 1;
-        std::queue<std::pair<int, int>> open;
+        constexpr NeighborTable kNeighbors = buildNeighborTable();
 
-        for (int x = 0; x < GameState::BOARD_SIZE; ++x)
+        // Step one cell in a direction; -1 at the board edge or through a wall. #
+        int stepFrom(const GameState &state, int cell, int dir)
         {
-            dist[targetRow][x] = 0;
-            open.push({x, targetRow});
+            const int next = kNeighbors.next[cell][dir];
+            if (next < 0)
+                return -1;
+            const int x = cell % GameState::BOARD_SIZE;
+            const int y = cell / GameState::BOARD_SIZE;
+            if (isBlockedBetween(state, x, y, x + kDirX[dir], y + kDirY[dir]))
+                return -1;
+            return next;
         }
 
-        const int dx[] = {0, 1, 0, -1};
-        const int dy[] = {-1, 0, 1, 0};
+        // Check if any pawn occupies a cell index. #
+        bool isOccupiedCell(const GameState &state, int cell)
+        {
+            return isOccupied(state, cell % GameState::BOARD_SIZE, cell / GameState::BOARD_SIZE);
+        }
 
-        while (!open.empty())
+        // Collect pawn destinations (ascending cell indices) with straight and diagonal jumps. #
+        int collectPawnTargets(const GameState &state, int playerId, uint8_t targets[kMaxPawnTargets])
         {
-            auto current = open.front();
-            open.pop();
+            const int idx = playerId - 1;
+            const int from = state.pawnY[idx] * GameState::BOARD_SIZE + state.pawnX[idx];
+            int count = 0;
 
-            int currentDist = dist[current.second][current.first];
+            auto add = [&](int cell)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    if (targets[i] == cell)
+                        return;
+                }
+                targets[count++] = static_cast<uint8_t>(cell);
+            };
 
-            for (int i = 0; i < 4; ++i)
+            for (int dir = 0; dir < 4; ++dir)
             {
-                int nx = current.first + dx[i];
-                int ny = current.second + dy[i];
-                if (!inBoundsCell(nx, ny))
+                const int step = stepFrom(state, from, dir);
+                if (step < 0)
                     continue;
-                if (dist[ny][nx] != -1)
+                if (!isOccupiedCell(state, step))
+                {
+                    add(step);
                     continue;
-                if (isBlockedBetween(state, current.first, current.second, nx, ny))
+                }
+
+                const int jump = stepFrom(state, step, dir);
+                if (jump >= 0 && !isOccupiedCell(state, jump))
+                {
+                    add(jump);
                     continue;
+                }
 
-                dist[ny][nx] = static_cast<int16_t>(currentDist + 1);
-                open.push({nx, ny});
+                // Straight jump blocked by a wall, the edge or another pawn: side-step diagonally.
+                for (int side : {(dir + 1) % 4, (dir + 3) % 4})
+                {
+                    const int diagonal = stepFrom(state, step, side);
+                    if (diagonal >= 0 && !isOccupiedCell(state, diagonal))
+                        add(diagonal);
+                }
             }
+
+            std::sort(targets, targets + count);
+            return count;
         }
     }
 
-    // Update cached distance grids if marked dirty. #
-    void updateDistanceCache(GameState &state)
-    {
-        if (state.distDirty == 0)
-            return;
+    // Return the number of seated players (2 unless set up for four). #
+    int playerCount(const GameState &state) { return state.playerCount == 4 ? 4 : 2; }
+    // Return the player whose turn follows playerId. #
+    int nextPlayer(const GameState &state, int playerId) { return (playerId % playerCount(state)) + 1; }
+    // Return the current player id. #
+    int currentPlayer(const GameState &state) { return state.currentPlayerId; }
+    // Return the winner id (0 if none). #
+    int winner(const GameState &state) { return state.winnerId; }
+    // Check if the game has ended. #
+    bool isGameOver(const GameState &state) { return state.winnerId != 0; }
 
-        computeDistancesToGoal(state, 1, state.distToGoal[0]);
-        computeDistancesToGoal(state, 2, state.distToGoal[1]);
-        state.distDirty = 0;
+    // Check if a cell lies on the goal side of the given player. #
+    bool isGoalCell(int playerId, int x, int y)
+    {
+        switch (playerId)
+        {
+        case 1:
+            return y == 0;
+        case 2:
+            return y == GameState::BOARD_SIZE - 1;
+        case 3:
+            return x == GameState::BOARD_SIZE - 1;
+        case 4:
+            return x == 0;
+        default:
+            return false;
+        }
     }
 
-    // Validate a pawn move under current walls and rules. #
-    bool isPawnMoveValid(const GameState &state, int playerId, int targetX, int targetY)
+    namespace
     {
-        if (playerId != 1 && playerId != 2)
-            return false;
-        if (!inBoundsCell(targetX, targetY))
-            return false;
-        if (isOccupied(state, targetX, targetY))
-            return false;
+        // Multi-source BFS from every goal cell of every player in playerMask. #
+        // Queue entries pack (player, cell) so all grids fill in one pass without heap use.
+        void computeGoalDistances(const GameState &state, unsigned playerMask,
+                                  int16_t grids[][GameState::BOARD_SIZE][GameState::BOARD_SIZE])
+        {
+            uint16_t open[GameState::MAX_PLAYERS * kCells];
+            int head = 0;
+            int tail = 0;
 
-        int idx = playerId - 1;
-        int startX = state.pawnX[idx];
-        int startY = state.pawnY[idx];
-        int dx = targetX - startX;
-        int dy = targetY - startY;
-        int distance = std::abs(dx) + std::abs(dy);
+            for (int p = 0; p < GameState::MAX_PLAYERS; ++p)
+            {
+                if ((playerMask & (1u << p)) == 0)
+                    continue;
 
-        if (distance != 1 && distance != 2)
-            return false;
+                int16_t(*dist)[GameState::BOARD_SIZE] = grids[p];
+                for (int y = 0; y < GameState::BOARD_SIZE; ++y)
+                {
+                    for (int x = 0; x < GameState::BOARD_SIZE; ++x)
+                    {
+                        if (isGoalCell(p + 1, x, y))
+                        {
+                            dist[y][x] = 0;
+                            open[tail++] = static_cast<uint16_t>(p * kCells + y * GameState::BOARD_SIZE + x);
+                        }
+                        else
+                        {
+                            dist[y][x] = -1;
+                        }
+                    }
+                }
+            }
 
-        int dirX = (dx == 0) ? 0 : (dx > 0 ? 1 : -1);
-        int dirY = (dy == 0) ? 0 : (dy > 0 ? 1 : -1);
+            const int dx[] = {0, 1, 0, -1};
+            const int dy[] = {-1, 0, 1, 0};
 
-        if (dirX == 1 && isBlockedBetween(state, startX, startY, startX + 1, startY))
-            return false;
-        if (dirX == -1 && isBlockedBetween(state, startX, startY, startX - 1, startY))
-            return false;
-        if (dirY == 1 && isBlockedBetween(state, startX, startY, startX, startY + 1))
-            return false;
-        if (dirY == -1 && isBlockedBetween(state, startX, startY, startX, startY - 1))
-            return false;
+            while (head < tail)
+            {
+                const int entry = open[head++];
+                const int p = entry / kCells;
+                const int cell = entry % kCells;
+                const int cx = cell % GameState::BOARD_SIZE;
+                const int cy = cell / GameState::BOARD_SIZE;
+                int16_t(*dist)[GameState::BOARD_SIZE] = grids[p];
+                const int currentDist = dist[cy][cx];
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    int nx = cx + dx[i];
+                    int ny = cy + dy[i];
+                    if (!inBoundsCell(nx, ny))
+                        continue;
+                    if (dist[ny][nx] != -1)
+                        continue;
+                    if (isBlockedBetween(state, cx, cy, nx, ny))
+                        continue;
+
+                    dist[ny][nx] = static_cast<int16_t>(currentDist + 1);
+                    open[tail++] = static_cast<uint16_t>(p * kCells + ny * GameState::BOARD_SIZE + nx);
+                }
+            }
+        }
+    }
 
-        if (distance == 1)
-            return true;
+    // Compute shortest distances to the goal side. #
+    void computeDistancesToGoal(const GameState &state, int playerId,
+                                int16_t dist[GameState::BOARD_SIZE][GameState::BOARD_SIZE])
+    {
+        if (!isSeated(state, playerId))
+        {
+            for (int y = 0; y < GameState::BOARD_SIZE; ++y)
+            {
+                for (int x = 0; x < GameState::BOARD_SIZE; ++x)
+                {
+                    dist[y][x] = -1;
+                }
+            }
+            return;
+        }
 
-        int intermediateX = startX + dirX;
-        int intermediateY = startY + dirY;
-        if (!inBoundsCell(intermediateX, intermediateY))
-            return false;
-        if (!isOpponentAt(state, playerId, intermediateX, intermediateY))
-            return false;
+        int16_t grids[GameState::MAX_PLAYERS][GameState::BOARD_SIZE][GameState::BOARD_SIZE];
+        computeGoalDistances(state, 1u << (playerId - 1), grids);
+        std::memcpy(dist, grids[playerId - 1], sizeof(grids[0]));
+    }
 
-        if (dirX == 1 && isBlockedBetween(state, intermediateX, intermediateY, intermediateX + 1, intermediateY))
-            return false;
-        if (dirX == -1 && isBlockedBetween(state, intermediateX, intermediateY, intermediateX - 1, intermediateY))
-            return false;
-        if (dirY == 1 && isBlockedBetween(state, intermediateX, intermediateY, intermediateX, intermediateY + 1))
+    // Update cached distance grids for all seated players if marked dirty (shared wall-layout cache first). #
+    void updateDistanceCache(GameState &state)
+    {
+        if (state.distDirty == 0)
+            return;
+
+        DistanceCache &cache = DistanceCache::instance();
+        const WallSetKey key = DistanceCache::keyFor(state);
+        if (!cache.probe(key, state.distToGoal))
+        {
+            const unsigned seatedMask = (1u << playerCount(state)) - 1u;
+            computeGoalDistances(state, seatedMask, state.distToGoal);
+            cache.store(key, state.distToGoal);
+        }
+        state.distDirty = 0;
+    }
+
+    // Validate a pawn move (step, straight jump or diagonal side-step) under current walls. #
+    bool isPawnMoveValid(const GameState &state, int playerId, int targetX, int targetY)
+    {
+        if (!isSeated(state, playerId))
             return false;
-        if (dirY == -1 && isBlockedBetween(state, intermediateX, intermediateY, intermediateX, intermediateY - 1))
+        if (!inBoundsCell(targetX, targetY))
             return false;
 
-        return true;
+        uint8_t targets[kMaxPawnTargets];
+        const int count = collectPawnTargets(state, playerId, targets);
+        const int target = targetY * GameState::BOARD_SIZE + targetX;
+        for (int i = 0; i < count; ++i)
+        {
+            if (targets[i] == target)
+                return true;
+        }
+        return false;
     }
 
     // Validate a wall placement including path availability. #
     bool isWallPlacementValid(const GameState &state, int playerId, int x, int y, Orientation orientation)
     {
-        if (playerId != 1 && playerId != 2)
+        if (!isSeated(state, playerId))
             return false;
 
         int idx = playerId - 1;
@@ -242,22 +384,22 @@ namespace Game
         temp.distDirty = 1;
         updateDistanceCache(temp);
 
-        int16_t p1Dist = temp.distToGoal[0][temp.pawnY[0]][temp.pawnX[0]];
-        int16_t p2Dist = temp.distToGoal[1][temp.pawnY[1]][temp.pawnX[1]];
-        if (p1Dist < 0 || p2Dist < 0)
-            return false;
+        const int seats = playerCount(temp);
+        for (int i = 0; i < seats; ++i)
+        {
+            if (temp.distToGoal[i][temp.pawnY[i]][temp.pawnX[i]] < 0)
+                return false;
+        }
 
         return true;
     }
 
-    // Check if a player has reached their goal row. #
+    // Check if a player has reached their goal side. #
     bool hasPlayerWon(const GameState &state, int playerId)
     {
-        if (playerId == 1)
-            return state.pawnY[0] == 0;
-        if (playerId == 2)
-            return state.pawnY[1] == GameState::BOARD_SIZE - 1;
-        return false;
+        if (!isSeated(state, playerId))
+            return false;
+        return isGoalCell(playerId, state.pawnX[playerId - 1], state.pawnY[playerId - 1]);
     }
 
     // Apply a move without validation and record undo data. #
@@ -266,7 +408,7 @@ namespace Game
         int playerId = move.playerId();
         if (playerId == 0)
             playerId = state.currentPlayerId;
-        if (playerId != 1 && playerId != 2)
+        if (!isSeated(state, playerId))
             return false;
 
         int idx = playerId - 1;
@@ -309,7 +451,7 @@ namespace Game
 
         if (hasPlayerWon(state, playerId))
             state.winnerId = static_cast<uint8_t>(playerId);
-        state.currentPlayerId = (playerId == 1) ? 2 : 1;
+        state.currentPlayerId = static_cast<uint8_t>(nextPlayer(state, playerId));
 
         return true;
     }
@@ -318,7 +460,7 @@ namespace Game
     void undoMove(GameState &state, const Move &move, const MoveUndoState &undoState)
     {
         int playerId = undoState.currentPlayerId;
-        if (playerId != 1 && playerId != 2)
+        if (!isSeated(state, playerId))
             return;
 
         int idx = playerId - 1;
@@ -376,48 +518,89 @@ namespace Game
         return applyMoveUnchecked(state, move, undoState);
     }
 
-    // Generate all legal moves for the current player. #
-    std::vector<Move> generateLegalMoves(const GameState &state)
+    // Generate all legal moves for the current player into a fixed buffer. #
+    void generateLegalMoves(const GameState &state, MoveList &moves)
+    {
+        moves.clear();
+        generatePawnMoves(state, moves);
+        generateWallMoves(state, moves);
+    }
+
+    // Append legal pawn moves for the current player. #
+    void generatePawnMoves(const GameState &state, MoveList &moves)
+    {
+        int playerId = state.currentPlayerId;
+        if (!isSeated(state, playerId))
+            return;
+
+        uint8_t targets[kMaxPawnTargets];
+        const int count = collectPawnTargets(state, playerId, targets);
+        for (int i = 0; i < count; ++i)
+            moves.push(Move::Pawn(targets[i] % GameState::BOARD_SIZE, targets[i] / GameState::BOARD_SIZE, playerId));
+    }
+
+    // Append locally legal wall placements for the current player (path check not included). #
+    void generateWallMoves(const GameState &state, MoveList &moves)
     {
-        std::vector<Move> moves;
         int playerId = state.currentPlayerId;
+        if (!isSeated(state, playerId) || state.wallsRemaining[playerId - 1] == 0)
+            return;
 
-        for (int y = 0; y < GameState::BOARD_SIZE; ++y)
+        for (int y = 0; y < GameState::WALL_GRID; ++y)
         {
-            for (int x = 0; x < GameState::BOARD_SIZE; ++x)
+            for (int x = 0; x < GameState::WALL_GRID; ++x)
             {
-                if (isPawnMoveValid(state, playerId, x, y))
-                    moves.push_back(Move::Pawn(x, y, playerId));
+                if (isWallPlacementLegalLocal(state.hWalls, state.vWalls, x, y, Orientation::Horizontal))
+                    moves.push(Move::Wall(x, y, Orientation::Horizontal, playerId));
+                if (isWallPlacementLegalLocal(state.hWalls, state.vWalls, x, y, Orientation::Vertical))
+                    moves.push(Move::Wall(x, y, Orientation::Vertical, playerId));
             }
         }
+    }
+
+    // Generate all legal moves for the current player. #
+    std::vector<Move> generateLegalMoves(const GameState &state)
+    {
+        MoveList buffer;
+        generateLegalMoves(state, buffer);
+        return std::vector<Move>(buffer.begin(), buffer.end());
+    }
 
-        if (state.wallsRemaining[playerId - 1] > 0)
+    // Return the opponent with the shortest path to its goal. #
+    int strongestOpponent(GameState &state, int playerId)
+    {
+        updateDistanceCache(state);
+
+        const int seats = playerCount(state);
+        int best = 0;
+        int bestDist = 0;
+        for (int id = 1; id <= seats; ++id)
         {
-            for (int y = 0; y < GameState::WALL_GRID; ++y)
+            if (id == playerId)
+                continue;
+            const int idx = id - 1;
+            int dist = state.distToGoal[idx][state.pawnY[idx]][state.pawnX[idx]];
+            if (dist < 0)
+                dist = GameState::BOARD_SIZE * GameState::BOARD_SIZE;
+            if (best == 0 || dist < bestDist)
             {
-                for (int x = 0; x < GameState::WALL_GRID; ++x)
-                {
-                    if (isWallPlacementLegalLocal(state.hWalls, state.vWalls, x, y, Orientation::Horizontal))
-                        moves.push_back(Move::Wall(x, y, Orientation::Horizontal, playerId));
-                    if (isWallPlacementLegalLocal(state.hWalls, state.vWalls, x, y, Orientation::Vertical))
-                        moves.push_back(Move::Wall(x, y, Orientation::Vertical, playerId));
-                }
+                best = id;
+                bestDist = dist;
             }
         }
-
-        return moves;
+        return best;
     }
 
-    // Score the game state for the given perspective. #
+    // Score the game state for the given perspective against the leading opponent. #
     int evaluateState(GameState &state, int perspectivePlayerId)
     {
         updateDistanceCache(state);
 
-        if (perspectivePlayerId != 1 && perspectivePlayerId != 2)
+        if (!isSeated(state, perspectivePlayerId))
             return 0;
 
         int myIdx = perspectivePlayerId - 1;
-        int oppIdx = (myIdx == 0) ? 1 : 0;
+        int oppIdx = strongestOpponent(state, perspectivePlayerId) - 1;
 
         int16_t myDist = state.distToGoal[myIdx][state.pawnY[myIdx]][state.pawnX[myIdx]];
         int16_t oppDist = state.distToGoal[oppIdx][state.pawnY[oppIdx]][state.pawnX[oppIdx]];
@@ -433,4 +616,41 @@ namespace Game
 
         return distScore * 10 + wallScore * 2;
     }
+
+    // Check what any reachable position satisfies: pawns on distinct cells, and walls that could have
+    // been placed one by one (no overlap or crossing). #
+    bool isPositionConsistent(const GameState &state)
+    {
+        const int seats = playerCount(state);
+        for (int i = 0; i < seats; ++i)
+        {
+            for (int j = 0; j < i; ++j)
+            {
+                if (state.pawnX[i] == state.pawnX[j] && state.pawnY[i] == state.pawnY[j])
+                    return false;
+            }
+        }
+
+        uint8_t hWalls[WALL_GRID][WALL_GRID] = {};
+        uint8_t vWalls[WALL_GRID][WALL_GRID] = {};
+        for (int y = 0; y < WALL_GRID; ++y)
+        {
+            for (int x = 0; x < WALL_GRID; ++x)
+            {
+                if (state.hWalls[x][y])
+                {
+                    if (!isWallPlacementLegalLocal(hWalls, vWalls, x, y, Orientation::Horizontal))
+                        return false;
+                    hWalls[x][y] = 1;
+                }
+                if (state.vWalls[x][y])
+                {
+                    if (!isWallPlacementLegalLocal(hWalls, vWalls, x, y, Orientation::Vertical))
+                        return false;
+                    vWalls[x][y] = 1;
+                }
+            }
+        }
+        return true;
+    }
 }
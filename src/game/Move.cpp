@@ -2,6 +2,12 @@
 
 namespace Game
 {
+    // Construct an empty placeholder move (used by fixed-size move lists). #
+    Move::Move()
+        : m_type(MoveType::PawnMove), m_x(0), m_y(0), m_orientation(Orientation::Horizontal), m_playerId(0)
+    {
+    }
+
     // Construct a move with explicit parameters. #
     Move::Move(MoveType type, int x, int y, Orientation orientation, int playerId)
         : m_type(type), m_x(x), m_y(y), m_orientation(orientation), m_playerId(playerId)
@@ -30,4 +36,18 @@ namespace Game
     Orientation Move::orientation() const { return m_orientation; }
     // Return player id. #
     int Move::playerId() const { return m_playerId; }
+
+    // Compare two moves for equivalence; orientation only matters for walls. #
+    bool sameMove(const Move &a, const Move &b)
+    {
+        if (a.type() != b.type())
+            return false;
+        if (a.x() != b.x() || a.y() != b.y())
+            return false;
+        if (a.type() == MoveType::WallPlacement && a.orientation() != b.orientation())
+            return false;
+        if (a.playerId() != 0 && b.playerId() != 0 && a.playerId() != b.playerId())
+            return false;
+        return true;
+    }
 }
@@ -0,0 +1,229 @@
+#include "game/Notation.hpp"
+#include "game/GameRules.hpp"
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace Game
+{
+    namespace
+    {
+        // Split a string on a separator character. #
+        std::vector<std::string> split(const std::string &text, char separator)
+        {
+            std::vector<std::string> parts;
+            std::string current;
+            for (char c : text)
+            {
+                if (c == separator)
+                {
+                    parts.push_back(current);
+                    current.clear();
+                }
+                else
+                {
+                    current.push_back(c);
+                }
+            }
+            parts.push_back(current);
+            return parts;
+        }
+
+        // Parse a square name into board coordinates. #
+        bool parseSquare(const std::string &text, int &x, int &y)
+        {
+            if (text.size() != 2)
+                return false;
+            x = text[0] - 'a';
+            const int rank = text[1] - '0';
+            y = GameState::BOARD_SIZE - rank;
+            return x >= 0 && x < GameState::BOARD_SIZE && rank >= 1 && rank <= GameState::BOARD_SIZE;
+        }
+
+        // Parse a wall name into anchor and orientation. #
+        bool parseWall(const std::string &text, int &x, int &y, Orientation &orientation)
+        {
+            if (text.size() != 3)
+                return false;
+            x = text[0] - 'a';
+            const int rank = text[1] - '0';
+            y = GameState::WALL_GRID - rank;
+            if (text[2] == 'h')
+                orientation = Orientation::Horizontal;
+            else if (text[2] == 'v')
+                orientation = Orientation::Vertical;
+            else
+                return false;
+            return x >= 0 && x < GameState::WALL_GRID && rank >= 1 && rank <= GameState::WALL_GRID;
+        }
+
+        // Name a wall anchor. #
+        std::string wallToText(int x, int y, Orientation orientation)
+        {
+            std::string text;
+            text.push_back(static_cast<char>('a' + x));
+            text.push_back(static_cast<char>('0' + (GameState::WALL_GRID - y)));
+            text.push_back(orientation == Orientation::Horizontal ? 'h' : 'v');
+            return text;
+        }
+
+        // Parse a small non-negative integer. #
+        bool parseCount(const std::string &text, int &value)
+        {
+            if (text.empty() || text.size() > 3)
+                return false;
+            value = 0;
+            for (char c : text)
+            {
+                if (c < '0' || c > '9')
+                    return false;
+                value = value * 10 + (c - '0');
+            }
+            return true;
+        }
+    }
+
+    // Name a board square. #
+    std::string squareToText(int x, int y)
+    {
+        std::string text;
+        text.push_back(static_cast<char>('a' + x));
+        text.push_back(static_cast<char>('0' + (GameState::BOARD_SIZE - y)));
+        return text;
+    }
+
+    // Format a move in standard notation. #
+    std::string moveToText(const Move &move)
+    {
+        if (move.type() == MoveType::WallPlacement)
+            return wallToText(move.x(), move.y(), move.orientation());
+        return squareToText(move.x(), move.y());
+    }
+
+    // Parse standard notation into a move for the given player. #
+    bool parseMove(const std::string &text, int playerId, Move &move)
+    {
+        int x = 0;
+        int y = 0;
+        if (text.size() == 2)
+        {
+            if (!parseSquare(text, x, y))
+                return false;
+            move = Move::Pawn(x, y, playerId);
+            return true;
+        }
+
+        Orientation orientation = Orientation::Horizontal;
+        if (!parseWall(text, x, y, orientation))
+            return false;
+        move = Move::Wall(x, y, orientation, playerId);
+        return true;
+    }
+
+    // Encode pawns, walls, wall counts, and side to move as one line. #
+    std::string positionToText(const GameState &state)
+    {
+        const int seats = playerCount(state);
+        std::ostringstream out;
+
+        for (int i = 0; i < seats; ++i)
+        {
+            if (i > 0)
+                out << ',';
+            out << squareToText(state.pawnX[i], state.pawnY[i]);
+        }
+
+        out << ' ';
+        bool anyWall = false;
+        for (int y = 0; y < GameState::WALL_GRID; ++y)
+        {
+            for (int x = 0; x < GameState::WALL_GRID; ++x)
+            {
+                for (Orientation ori : {Orientation::Horizontal, Orientation::Vertical})
+                {
+                    const bool placed = (ori == Orientation::Horizontal) ? state.hWalls[x][y] : state.vWalls[x][y];
+                    if (!placed)
+                        continue;
+                    if (anyWall)
+                        out << ',';
+                    out << wallToText(x, y, ori);
+                    anyWall = true;
+                }
+            }
+        }
+        if (!anyWall)
+            out << '-';
+
+        out << ' ';
+        for (int i = 0; i < seats; ++i)
+        {
+            if (i > 0)
+                out << ',';
+            out << static_cast<int>(state.wallsRemaining[i]);
+        }
+
+        out << ' ' << static_cast<int>(state.currentPlayerId);
+        return out.str();
+    }
+
+    // Decode a position line, rejecting what decodePosition rejects; the winner is derived from pawn placement. #
+    bool parsePosition(const std::string &text, GameState &state)
+    {
+        std::istringstream in(text);
+        std::string pawnField, wallField, countField, turnField;
+        if (!(in >> pawnField >> wallField >> countField >> turnField))
+            return false;
+
+        const std::vector<std::string> pawns = split(pawnField, ',');
+        const std::vector<std::string> counts = split(countField, ',');
+        const int seats = static_cast<int>(pawns.size());
+        if ((seats != 2 && seats != 4) || static_cast<int>(counts.size()) != seats)
+            return false;
+
+        GameState parsed{};
+        initGameState(parsed, seats);
+
+        for (int i = 0; i < seats; ++i)
+        {
+            int x = 0, y = 0, walls = 0;
+            if (!parseSquare(pawns[i], x, y) || !parseCount(counts[i], walls) ||
+                walls > GameState::MAX_WALLS_PER_PLAYER)
+                return false;
+            parsed.pawnX[i] = static_cast<uint8_t>(x);
+            parsed.pawnY[i] = static_cast<uint8_t>(y);
+            parsed.wallsRemaining[i] = static_cast<uint8_t>(walls);
+        }
+
+        if (wallField != "-")
+        {
+            for (const std::string &wall : split(wallField, ','))
+            {
+                int x = 0, y = 0;
+                Orientation orientation = Orientation::Horizontal;
+                if (!parseWall(wall, x, y, orientation))
+                    return false;
+                if (orientation == Orientation::Horizontal)
+                    parsed.hWalls[x][y] = 1;
+                else
+                    parsed.vWalls[x][y] = 1;
+            }
+        }
+
+        int turn = 0;
+        if (!parseCount(turnField, turn) || turn < 1 || turn > seats)
+            return false;
+        parsed.currentPlayerId = static_cast<uint8_t>(turn);
+        if (!isPositionConsistent(parsed))
+            return false;
+
+        for (int id = 1; id <= seats; ++id)
+        {
+            if (hasPlayerWon(parsed, id))
+                parsed.winnerId = static_cast<uint8_t>(id);
+        }
+
+        state = parsed;
+        return true;
+    }
+}
@@ -1,7 +1,5 @@
 #include "game/Pawn.hpp"
 #include "game/Board.hpp"
-#include "ui/UiConstants.hpp"
-#include <cmath>
 #include "game/GameRules.hpp"
 #include <cstring>
 
@@ -26,6 +24,7 @@ namespace Game
             state.wallsRemaining[0] = GameState::MAX_WALLS_PER_PLAYER;
             state.wallsRemaining[1] = GameState::MAX_WALLS_PER_PLAYER;
             state.distDirty = 1;
+            state.playerCount = 2;
             state.currentPlayerId = 1;
             state.winnerId = 0;
 
@@ -49,30 +48,15 @@ namespace Game
         }
     }
 
-    // Construct a pawn and initialize its sprite. #
+    // Construct a pawn on the grid; GameRenderer draws it from the atlas. #
     Pawn::Pawn(int id, int startX, int startY)
-        : VisualEntity(startX, startY), m_id(id)
+        : Entity(startX, startY), m_id(id)
     {
-        (void)initSprite();
     }
 
     // Return pawn id. #
     int Pawn::id() const { return m_id; }
 
-    // Resolve the texture path for this pawn id. #
-    std::string Pawn::getTexturePath() const
-    {
-        if (m_id == 1)
-            return "assets/textures/pawn_p1.png";
-        return "assets/textures/pawn_p2.png";
-    }
-
-    // Compute the sprite origin for baseline alignment. #
-    sf::Vector2f Pawn::getSpriteOrigin(const sf::Vector2u &texSize) const
-    {
-        return {float(texSize.x) / 2.f, float(texSize.y) - UI::PAWN_BASELINE_OFFSET};
-    }
-
     // Validate a pawn move using game rules on a derived state. #
     bool Pawn::isValidMove(const Board &board, int targetX, int targetY) const
     {
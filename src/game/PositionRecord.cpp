@@ -0,0 +1,126 @@
+#include "game/PositionRecord.hpp"
+#include "game/GameRules.hpp"
+
+namespace Game
+{
+    namespace
+    {
+        constexpr uint8_t kNoPawn = 0xFF;
+        constexpr uint8_t kFourPlayerFlag = 0x04;
+
+        // Store a 64-bit value little-endian. #
+        void writeU64(uint8_t *out, uint64_t value)
+        {
+            for (int i = 0; i < 8; ++i)
+                out[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+
+        // Load a 64-bit little-endian value. #
+        uint64_t readU64(const uint8_t *in)
+        {
+            uint64_t value = 0;
+            for (int i = 0; i < 8; ++i)
+                value |= static_cast<uint64_t>(in[i]) << (8 * i);
+            return value;
+        }
+    }
+
+    // Collect wall anchors into two 64-bit sets. #
+    void packWalls(const GameState &state, uint64_t &hWalls, uint64_t &vWalls)
+    {
+        hWalls = 0;
+        vWalls = 0;
+        for (int y = 0; y < GameState::WALL_GRID; ++y)
+        {
+            for (int x = 0; x < GameState::WALL_GRID; ++x)
+            {
+                if (state.hWalls[x][y])
+                    hWalls |= wallBit(x, y);
+                if (state.vWalls[x][y])
+                    vWalls |= wallBit(x, y);
+            }
+        }
+    }
+
+    // Expand two 64-bit sets into wall anchors. #
+    void unpackWalls(uint64_t hWalls, uint64_t vWalls, GameState &state)
+    {
+        for (int y = 0; y < GameState::WALL_GRID; ++y)
+        {
+            for (int x = 0; x < GameState::WALL_GRID; ++x)
+            {
+                state.hWalls[x][y] = (hWalls & wallBit(x, y)) ? 1 : 0;
+                state.vWalls[x][y] = (vWalls & wallBit(x, y)) ? 1 : 0;
+            }
+        }
+        state.distDirty = 1;
+    }
+
+    // Pack a state into a fixed-size record. #
+    void encodePosition(const GameState &state, PositionRecord &record)
+    {
+        const int seats = playerCount(state);
+        uint8_t *out = record.bytes;
+
+        for (int i = 0; i < GameState::MAX_PLAYERS; ++i)
+        {
+            out[i] = (i < seats)
+                         ? static_cast<uint8_t>(state.pawnY[i] * GameState::BOARD_SIZE + state.pawnX[i])
+                         : kNoPawn;
+        }
+
+        uint64_t hWalls = 0;
+        uint64_t vWalls = 0;
+        packWalls(state, hWalls, vWalls);
+        writeU64(out + 4, hWalls);
+        writeU64(out + 12, vWalls);
+
+        out[20] = 0;
+        out[21] = 0;
+        for (int i = 0; i < seats; ++i)
+            out[20 + i / 2] |= static_cast<uint8_t>((state.wallsRemaining[i] & 0x0F) << (4 * (i % 2)));
+
+        out[22] = static_cast<uint8_t>(((state.currentPlayerId - 1) & 0x03) |
+                                       (seats == 4 ? kFourPlayerFlag : 0));
+        out[23] = 0;
+    }
+
+    // Unpack a record, rejecting out-of-range fields, shared pawn cells and overlapping or crossing walls. #
+    bool decodePosition(const PositionRecord &record, GameState &state)
+    {
+        const uint8_t *in = record.bytes;
+        const int seats = (in[22] & kFourPlayerFlag) ? 4 : 2;
+        const int turn = (in[22] & 0x03) + 1;
+        if (turn > seats || in[23] != 0)
+            return false;
+
+        GameState decoded{};
+        initGameState(decoded, seats);
+
+        for (int i = 0; i < seats; ++i)
+        {
+            const int cell = in[i];
+            const int walls = (in[20 + i / 2] >> (4 * (i % 2))) & 0x0F;
+            if (cell >= GameState::BOARD_SIZE * GameState::BOARD_SIZE ||
+                walls > GameState::MAX_WALLS_PER_PLAYER)
+                return false;
+            decoded.pawnX[i] = static_cast<uint8_t>(cell % GameState::BOARD_SIZE);
+            decoded.pawnY[i] = static_cast<uint8_t>(cell / GameState::BOARD_SIZE);
+            decoded.wallsRemaining[i] = static_cast<uint8_t>(walls);
+        }
+
+        unpackWalls(readU64(in + 4), readU64(in + 12), decoded);
+        if (!isPositionConsistent(decoded))
+            return false;
+        decoded.currentPlayerId = static_cast<uint8_t>(turn);
+
+        for (int id = 1; id <= seats; ++id)
+        {
+            if (hasPlayerWon(decoded, id))
+                decoded.winnerId = static_cast<uint8_t>(id);
+        }
+
+        state = decoded;
+        return true;
+    }
+}
@@ -0,0 +1,486 @@
+#include "heuristic/EndgameTablebase.hpp"
+#include "game/GameRules.hpp"
+#include "game/PositionRecord.hpp"
+#include "game/WallRules.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace Game
+{
+    namespace
+    {
+        constexpr int kCells = GameState::BOARD_SIZE * GameState::BOARD_SIZE;
+        constexpr int kPositions = 2 * kCells * kCells;
+        constexpr int16_t kWinBase = 1024; // Win in n plies is stored as kWinBase - n #
+        constexpr char kMagic[4] = {'Q', 'T', 'B', '2'}; // '2': pawn moves include diagonal jumps
+
+        // Index of (side to move, pawn cells) inside a table. #
+        int positionIndex(int stmIdx, int cell1, int cell2)
+        {
+            return (stmIdx * kCells + cell1) * kCells + cell2;
+        }
+
+        // Encode a resolved outcome into a table value. #
+        int16_t encodeOutcome(bool win, int plies)
+        {
+            const int16_t magnitude = static_cast<int16_t>(kWinBase - plies);
+            return win ? magnitude : static_cast<int16_t>(-magnitude);
+        }
+
+        // Copy a packed layout into a scratch two-player state. #
+        void applyLayout(GameState &state, const TablebaseKey &key)
+        {
+            unpackWalls(key.hWalls, key.vWalls, state);
+            state.wallsRemaining[0] = key.wallsRemaining[0];
+            state.wallsRemaining[1] = key.wallsRemaining[1];
+        }
+
+        // Append little-endian bytes of an integer. #
+        template <typename T>
+        void writeLE(std::ofstream &out, T value)
+        {
+            for (size_t i = 0; i < sizeof(T); ++i)
+                out.put(static_cast<char>((static_cast<uint64_t>(value) >> (8 * i)) & 0xFF));
+        }
+
+        // Read little-endian bytes of an integer. #
+        template <typename T>
+        bool readLE(std::ifstream &in, T &value)
+        {
+            uint64_t raw = 0;
+            for (size_t i = 0; i < sizeof(T); ++i)
+            {
+                const int byte = in.get();
+                if (byte == EOF)
+                    return false;
+                raw |= static_cast<uint64_t>(byte & 0xFF) << (8 * i);
+            }
+            value = static_cast<T>(raw);
+            return true;
+        }
+    }
+
+    // Compare layout and wall counts. #
+    bool TablebaseKey::operator==(const TablebaseKey &other) const
+    {
+        return hWalls == other.hWalls && vWalls == other.vWalls &&
+               wallsRemaining[0] == other.wallsRemaining[0] &&
+               wallsRemaining[1] == other.wallsRemaining[1];
+    }
+
+    // Mix layout bits and wall counts into a bucket hash. #
+    size_t TablebaseKeyHash::operator()(const TablebaseKey &key) const
+    {
+        uint64_t h = key.hWalls * 0x9E3779B97F4A7C15ULL;
+        h ^= key.vWalls + 0xC2B2AE3D27D4EB4FULL + (h << 6) + (h >> 2);
+        h ^= (uint64_t(key.wallsRemaining[0]) << 8) | key.wallsRemaining[1];
+        return static_cast<size_t>(h);
+    }
+
+    // Create an empty cache with a bound on resident tables. #
+    EndgameTablebase::EndgameTablebase(size_t maxTables)
+        : m_maxTables(maxTables == 0 ? 1 : maxTables)
+    {
+    }
+
+    // Set the directory used to load and persist tables. #
+    void EndgameTablebase::setStorageDirectory(const std::string &path)
+    {
+        m_storageDirectory = path;
+    }
+
+    // Drop all cached tables. #
+    void EndgameTablebase::clear()
+    {
+        m_tables.clear();
+        m_insertOrder.clear();
+    }
+
+    // Check that the state is a two-player game with few enough walls left. #
+    bool EndgameTablebase::covers(const GameState &state, int maxTotalWalls)
+    {
+        if (playerCount(state) != 2 || state.winnerId != 0)
+            return false;
+        const int limit = std::min(maxTotalWalls, MAX_TOTAL_WALLS);
+        return state.wallsRemaining[0] + state.wallsRemaining[1] <= limit;
+    }
+
+    // Pack the wall layout and wall counts of a state. #
+    TablebaseKey EndgameTablebase::keyFor(const GameState &state)
+    {
+        TablebaseKey key;
+        packWalls(state, key.hWalls, key.vWalls);
+        key.wallsRemaining[0] = state.wallsRemaining[0];
+        key.wallsRemaining[1] = state.wallsRemaining[1];
+        return key;
+    }
+
+    // Make sure the table for this state (and the tables it depends on) is cached. #
+    // shouldStop is polled between tables; tables finished before a stop stay cached for the next call.
+    bool EndgameTablebase::prepare(const GameState &state, const std::function<bool()> &shouldStop)
+    {
+        if (!covers(state, MAX_TOTAL_WALLS))
+            return false;
+        return ensureTable(keyFor(state), shouldStop) != nullptr;
+    }
+
+    // Look up the exact outcome of a state if its table is resident. #
+    bool EndgameTablebase::probe(const GameState &state, TablebaseResult &result) const
+    {
+        if (!covers(state, MAX_TOTAL_WALLS))
+            return false;
+
+        auto it = m_tables.find(keyFor(state));
+        if (it == m_tables.end())
+            return false;
+
+        const int stmIdx = state.currentPlayerId - 1;
+        const int cell1 = state.pawnY[0] * GameState::BOARD_SIZE + state.pawnX[0];
+        const int cell2 = state.pawnY[1] * GameState::BOARD_SIZE + state.pawnX[1];
+        const int16_t value = it->second->values[positionIndex(stmIdx, cell1, cell2)];
+
+        if (value == 0)
+        {
+            result.outcome = 0;
+            result.plies = 0;
+        }
+        else
+        {
+            result.outcome = value > 0 ? 1 : -1;
+            result.plies = kWinBase - (value > 0 ? value : -value);
+        }
+        return true;
+    }
+
+    // Number of tables currently held in memory. #
+    size_t EndgameTablebase::tableCount() const
+    {
+        return m_tables.size();
+    }
+
+    // Return a cached table, loading it from disk or generating it on a miss. #
+    const EndgameTablebase::Table *EndgameTablebase::ensureTable(const TablebaseKey &key,
+                                                                 const std::function<bool()> &shouldStop)
+    {
+        auto it = m_tables.find(key);
+        if (it != m_tables.end())
+            return it->second.get();
+
+        std::unique_ptr<Table> table = loadFromDisk(key);
+        if (!table)
+        {
+            if (shouldStop && shouldStop())
+                return nullptr;
+            table = generate(key, shouldStop);
+            if (!table)
+                return nullptr;
+            saveToDisk(key, *table);
+        }
+        return &insert(key, std::move(table));
+    }
+
+    // Store a table, evicting the oldest ones past the size bound. #
+    const EndgameTablebase::Table &EndgameTablebase::insert(const TablebaseKey &key, std::unique_ptr<Table> table)
+    {
+        while (m_tables.size() >= m_maxTables && !m_insertOrder.empty())
+        {
+            m_tables.erase(m_insertOrder.front());
+            m_insertOrder.pop_front();
+        }
+
+        const Table &stored = *table;
+        m_tables[key] = std::move(table);
+        m_insertOrder.push_back(key);
+        return stored;
+    }
+
+    // Solve every pawn placement of a layout by retrograde analysis. #
+    // Pawn moves stay inside the table; wall placements lead to already solved child tables.
+    std::unique_ptr<EndgameTablebase::Table> EndgameTablebase::generate(const TablebaseKey &key,
+                                                                        const std::function<bool()> &shouldStop)
+    {
+        enum EventType : uint32_t
+        {
+            EventWin = 0,
+            EventDecrement = 1,
+            EventLoss = 2
+        };
+
+        GameState scratch{};
+        initGameState(scratch, 2);
+        applyLayout(scratch, key);
+        MoveList pawnMoves;
+
+        std::vector<uint8_t> pending(kPositions, 0);
+        std::vector<uint8_t> resolved(kPositions, 0);
+        std::vector<int> predStart(kPositions + 1, 0);
+        std::vector<int> forwardEdges;
+        std::vector<int> forwardFrom;
+        std::vector<std::vector<uint32_t>> buckets(1);
+
+        auto schedule = [&buckets](int level, int index, EventType type)
+        {
+            if (level >= static_cast<int>(buckets.size()))
+                buckets.resize(level + 1);
+            buckets[level].push_back((static_cast<uint32_t>(index) << 2) | type);
+        };
+
+        auto table = std::make_unique<Table>();
+        table->values.assign(kPositions, 0);
+
+        // Pass 1: in-table pawn successors and terminal positions.
+        for (int stmIdx = 0; stmIdx < 2; ++stmIdx)
+        {
+            for (int cell1 = 0; cell1 < kCells; ++cell1)
+            {
+                for (int cell2 = 0; cell2 < kCells; ++cell2)
+                {
+                    if (cell1 == cell2)
+                        continue;
+
+                    const int index = positionIndex(stmIdx, cell1, cell2);
+                    const int x1 = cell1 % GameState::BOARD_SIZE, y1 = cell1 / GameState::BOARD_SIZE;
+                    const int x2 = cell2 % GameState::BOARD_SIZE, y2 = cell2 / GameState::BOARD_SIZE;
+                    const bool p1Home = isGoalCell(1, x1, y1);
+                    const bool p2Home = isGoalCell(2, x2, y2);
+                    if (p1Home || p2Home)
+                    {
+                        // The side that just moved reached its goal: side to move has lost.
+                        const bool moverHome = (stmIdx == 0) ? p2Home : p1Home;
+                        if (moverHome && !(p1Home && p2Home))
+                            schedule(0, index, EventLoss);
+                        continue;
+                    }
+
+                    scratch.pawnX[0] = static_cast<uint8_t>(x1);
+                    scratch.pawnY[0] = static_cast<uint8_t>(y1);
+                    scratch.pawnX[1] = static_cast<uint8_t>(x2);
+                    scratch.pawnY[1] = static_cast<uint8_t>(y2);
+
+                    scratch.currentPlayerId = static_cast<uint8_t>(stmIdx + 1);
+                    pawnMoves.clear();
+                    generatePawnMoves(scratch, pawnMoves);
+                    for (const Move &move : pawnMoves)
+                    {
+                        const int target = move.y() * GameState::BOARD_SIZE + move.x();
+                        const int child = (stmIdx == 0) ? positionIndex(1, target, cell2)
+                                                        : positionIndex(0, cell1, target);
+                        forwardFrom.push_back(index);
+                        forwardEdges.push_back(child);
+                        ++predStart[child + 1];
+                        ++pending[index];
+                    }
+                }
+            }
+        }
+
+        // Reverse the edge list so resolved children can reach their parents.
+        for (int i = 0; i < kPositions; ++i)
+            predStart[i + 1] += predStart[i];
+        std::vector<int> preds(forwardEdges.size());
+        {
+            std::vector<int> fill(predStart.begin(), predStart.end() - 1);
+            for (size_t e = 0; e < forwardEdges.size(); ++e)
+                preds[fill[forwardEdges[e]]++] = forwardFrom[e];
+        }
+        forwardEdges.clear();
+        forwardFrom.clear();
+
+        // Pass 2: wall placements lead into solved child tables one wall down.
+        for (int stmIdx = 0; stmIdx < 2; ++stmIdx)
+        {
+            if (key.wallsRemaining[stmIdx] == 0)
+                continue;
+
+            for (int wy = 0; wy < GameState::WALL_GRID; ++wy)
+            {
+                for (int wx = 0; wx < GameState::WALL_GRID; ++wx)
+                {
+                    for (Orientation ori : {Orientation::Horizontal, Orientation::Vertical})
+                    {
+                        if (!isWallPlacementLegalLocal(scratch.hWalls, scratch.vWalls, wx, wy, ori))
+                            continue;
+
+                        TablebaseKey childKey = key;
+                        if (ori == Orientation::Horizontal)
+                            childKey.hWalls |= wallBit(wx, wy);
+                        else
+                            childKey.vWalls |= wallBit(wx, wy);
+                        childKey.wallsRemaining[stmIdx] = static_cast<uint8_t>(childKey.wallsRemaining[stmIdx] - 1);
+
+                        GameState childState = scratch;
+                        applyLayout(childState, childKey);
+                        int16_t dist1[GameState::BOARD_SIZE][GameState::BOARD_SIZE];
+                        int16_t dist2[GameState::BOARD_SIZE][GameState::BOARD_SIZE];
+                        computeDistancesToGoal(childState, 1, dist1);
+                        computeDistancesToGoal(childState, 2, dist2);
+
+                        const Table *childTable = ensureTable(childKey, shouldStop);
+                        if (!childTable)
+                            return nullptr;
+                        for (int cell1 = 0; cell1 < kCells; ++cell1)
+                        {
+                            const int x1 = cell1 % GameState::BOARD_SIZE, y1 = cell1 / GameState::BOARD_SIZE;
+                            if (dist1[y1][x1] <= 0)
+                                continue;
+                            for (int cell2 = 0; cell2 < kCells; ++cell2)
+                            {
+                                const int x2 = cell2 % GameState::BOARD_SIZE, y2 = cell2 / GameState::BOARD_SIZE;
+                                if (cell1 == cell2 || dist2[y2][x2] <= 0)
+                                    continue;
+
+                                const int index = positionIndex(stmIdx, cell1, cell2);
+                                ++pending[index];
+                                const int16_t childValue = childTable->values[positionIndex(1 - stmIdx, cell1, cell2)];
+                                if (childValue < 0)
+                                    schedule(kWinBase + childValue + 1, index, EventWin);
+                                else if (childValue > 0)
+                                    schedule(kWinBase - childValue + 1, index, EventDecrement);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Pass 3: settle positions level by level; unresolved ones are draws.
+        for (size_t level = 0; level < buckets.size(); ++level)
+        {
+            for (size_t i = 0; i < buckets[level].size(); ++i)
+            {
+                const uint32_t event = buckets[level][i];
+                const int index = static_cast<int>(event >> 2);
+                const EventType type = static_cast<EventType>(event & 3u);
+                if (resolved[index])
+                    continue;
+
+                bool win = false;
+                if (type == EventWin)
+                {
+                    win = true;
+                }
+                else if (type == EventDecrement)
+                {
+                    if (pending[index] == 0 || --pending[index] != 0)
+                        continue;
+                }
+
+                resolved[index] = 1;
+                table->values[index] = encodeOutcome(win, static_cast<int>(level));
+
+                for (int p = predStart[index]; p < predStart[index + 1]; ++p)
+                    schedule(static_cast<int>(level) + 1, preds[p], win ? EventDecrement : EventWin);
+            }
+        }
+
+        return table;
+    }
+
+    // Build the file name for a key inside the storage directory. #
+    std::string EndgameTablebase::pathFor(const TablebaseKey &key) const
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%016llx%016llx_%u%u.qtb",
+                      static_cast<unsigned long long>(key.hWalls),
+                      static_cast<unsigned long long>(key.vWalls),
+                      static_cast<unsigned>(key.wallsRemaining[0]),
+                      static_cast<unsigned>(key.wallsRemaining[1]));
+        return (std::filesystem::path(m_storageDirectory) / name).string();
+    }
+
+    // Read a run-length encoded table file if present and well-formed. #
+    std::unique_ptr<EndgameTablebase::Table> EndgameTablebase::loadFromDisk(const TablebaseKey &key) const
+    {
+        if (m_storageDirectory.empty())
+            return nullptr;
+
+        std::ifstream in(pathFor(key), std::ios::binary);
+        if (!in)
+            return nullptr;
+
+        char magic[4] = {};
+        in.read(magic, sizeof(magic));
+        uint64_t hWalls = 0, vWalls = 0;
+        uint8_t walls1 = 0, walls2 = 0;
+        uint32_t runCount = 0;
+        if (!in || !std::equal(magic, magic + 4, kMagic) ||
+            !readLE(in, hWalls) || !readLE(in, vWalls) ||
+            !readLE(in, walls1) || !readLE(in, walls2) || !readLE(in, runCount))
+            return nullptr;
+        if (hWalls != key.hWalls || vWalls != key.vWalls ||
+            walls1 != key.wallsRemaining[0] || walls2 != key.wallsRemaining[1])
+            return nullptr;
+
+        auto table = std::make_unique<Table>();
+        table->values.reserve(kPositions);
+        for (uint32_t run = 0; run < runCount; ++run)
+        {
+            uint16_t length = 0;
+            int16_t value = 0;
+            if (!readLE(in, length) || !readLE(in, value))
+                return nullptr;
+            if (table->values.size() + length > static_cast<size_t>(kPositions))
+                return nullptr;
+            table->values.insert(table->values.end(), length, value);
+        }
+
+        if (table->values.size() != static_cast<size_t>(kPositions))
+            return nullptr;
+        return table;
+    }
+
+    // Write a table as (length, value) runs; most of a pawn race compresses well. #
+    void EndgameTablebase::saveToDisk(const TablebaseKey &key, const Table &table) const
+    {
+        if (m_storageDirectory.empty())
+            return;
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_storageDirectory, ec);
+
+        std::vector<std::pair<uint16_t, int16_t>> runs;
+        for (int16_t value : table.values)
+        {
+            if (!runs.empty() && runs.back().second == value && runs.back().first < 0xFFFF)
+                ++runs.back().first;
+            else
+                runs.push_back({1, value});
+        }
+
+        // Write to a private temp file and rename, so concurrent engines never see a partial table.
+        const std::string finalPath = pathFor(key);
+        std::ostringstream tempName;
+        tempName << finalPath << ".tmp" << std::this_thread::get_id();
+        const std::string tempPath = tempName.str();
+
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            std::cerr << "Failed to write tablebase: " << finalPath << "\n";
+            return;
+        }
+
+        out.write(kMagic, sizeof(kMagic));
+        writeLE(out, key.hWalls);
+        writeLE(out, key.vWalls);
+        writeLE(out, key.wallsRemaining[0]);
+        writeLE(out, key.wallsRemaining[1]);
+        writeLE(out, static_cast<uint32_t>(runs.size()));
+        for (const auto &run : runs)
+        {
+            writeLE(out, run.first);
+            writeLE(out, static_cast<uint16_t>(run.second));
+        }
+        out.close();
+
+        std::filesystem::rename(tempPath, finalPath, ec);
+        if (ec)
+            std::filesystem::remove(tempPath, ec);
+    }
+}
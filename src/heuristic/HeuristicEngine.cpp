@@ -1,9 +1,12 @@
 #include "heuristic/HeuristicEngine.hpp"
+#include "heuristic/TimeManager.hpp"
 #include "game/GameRules.hpp"
+#include "game/WallRules.hpp"
 
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 namespace Game
@@ -11,18 +14,36 @@ namespace Game
     namespace
     {
         constexpr int kWinScore = 1000000;
+        constexpr int kMaxSearchPly = 64;
+        constexpr int kKillerSlots = 2;
+        constexpr int kMinCyclePlies = 4; // Shortest sequence that can repeat a position #
+        constexpr int kNoRepetition = std::numeric_limits<int>::max();
+        constexpr int kTablebaseBudgetDivisor = 4; // Table generation may use a quarter of the soft limit #
+
+        using DistanceGrids = int16_t[GameState::MAX_PLAYERS][GameState::BOARD_SIZE][GameState::BOARD_SIZE];
 
         struct SearchContext
         {
             const HeuristicSearchConfig *config = nullptr;
             TranspositionTable *tt = nullptr;
+            const EndgameTablebase *tablebase = nullptr;
             std::chrono::steady_clock::time_point deadline;
             int rootPlayerId = 1;
             int64_t nodes = 0;
-            bool timeUp = false;
+            int64_t maxNodes = 0; // 0 = unlimited #
+            bool useClock = true;
+            const std::atomic<bool> *stop = nullptr; // External stop request #
+            bool timeUp = false; // Time or node budget exhausted #
+            int ply = 0; // Moves applied below the root #
+            bool distSaved[kMaxSearchPly] = {}; // Parent grids were saved at this ply #
+            DistanceGrids distStack[kMaxSearchPly]; // Parent distance grids per ply #
+            Move killers[kMaxSearchPly][kKillerSlots]; // Walls that caused cutoffs per ply #
+            uint64_t pathKeys[kMaxSearchPly + 1] = {}; // Position key per ply on the current path #
+            int reversible[kMaxSearchPly + 1] = {}; // Plies since the last wall on the path #
+            const std::vector<uint64_t> *gameKeys = nullptr; // Sorted keys of earlier game positions #
+            int repetitionRef = kNoRepetition; // Shallowest ply a repetition below the current node refers to #
         };
 
-        constexpr int kTTMoveBonus = 10000000;
         constexpr int kPawnReduceDistBonus = 1000;
         constexpr int kWallBlocksOppBonus = 1000;
         constexpr int kWallBlocksSelfPenalty = 700;
@@ -31,20 +52,6 @@ namespace Game
         constexpr int kWallCloseRadiusSelf = 1;
         constexpr size_t kMaxWallMoves = 32;
 
-        // Compare two moves for equivalence. #
-        bool sameMove(const Move &a, const Move &b)
-        {
-            if (a.type() != b.type())
-                return false;
-            if (a.x() != b.x() || a.y() != b.y())
-                return false;
-            if (a.type() == MoveType::WallPlacement && a.orientation() != b.orientation())
-                return false;
-            if (a.playerId() != 0 && b.playerId() != 0 && a.playerId() != b.playerId())
-                return false;
-            return true;
-        }
-
         // Compute Manhattan distance between two grid points. #
         int manhattan(int ax, int ay, int bx, int by)
         {
@@ -187,16 +194,29 @@ namespace Game
             return count;
         }
 
-        // Score a position using heuristic weights. #
+        // Compute the evaluation terms of one seat against another (distances must be cached). #
+        EvaluationFeatures featuresAgainst(const GameState &state, int myIdx, int oppIdx)
+        {
+            EvaluationFeatures features;
+            features.distance = static_cast<int>(state.distToGoal[oppIdx][state.pawnY[oppIdx]][state.pawnX[oppIdx]]) -
+                                static_cast<int>(state.distToGoal[myIdx][state.pawnY[myIdx]][state.pawnX[myIdx]]);
+            features.walls = static_cast<int>(state.wallsRemaining[myIdx]) -
+                             static_cast<int>(state.wallsRemaining[oppIdx]);
+            features.width = countReducingNeighbors(state, myIdx) -
+                             countReducingNeighbors(state, oppIdx);
+            return features;
+        }
+
+        // Score a position using heuristic weights against the leading opponent. #
         int evaluateHeuristic(GameState &state, const HeuristicSearchConfig &config, int perspectivePlayerId)
         {
             updateDistanceCache(state);
 
-            if (perspectivePlayerId != 1 && perspectivePlayerId != 2)
+            if (perspectivePlayerId < 1 || perspectivePlayerId > playerCount(state))
                 return 0;
 
             int myIdx = perspectivePlayerId - 1;
-            int oppIdx = (myIdx == 0) ? 1 : 0;
+            int oppIdx = strongestOpponent(state, perspectivePlayerId) - 1;
 
             int16_t myDist = state.distToGoal[myIdx][state.pawnY[myIdx]][state.pawnX[myIdx]];
             int16_t oppDist = state.distToGoal[oppIdx][state.pawnY[oppIdx]][state.pawnX[oppIdx]];
@@ -206,168 +226,330 @@ namespace Game
             if (oppDist < 0)
                 return kWinScore / 2;
 
-            int distScore = static_cast<int>(oppDist - myDist);
-            int wallScore = static_cast<int>(state.wallsRemaining[myIdx]) -
-                            static_cast<int>(state.wallsRemaining[oppIdx]);
-            int widthScore = countReducingNeighbors(state, myIdx) -
-                             countReducingNeighbors(state, oppIdx);
-
-            return distScore * config.weightDistance +
-                   wallScore * config.weightWalls +
-                   widthScore * config.weightWidth;
+            return weightedEvaluation(featuresAgainst(state, myIdx, oppIdx), config);
         }
 
-        // Generate and order moves using heuristic scoring. #
-        std::vector<Move> generateOrderedMoves(GameState &state, SearchContext &ctx,
-                                               const std::optional<Move> &ttBestMove)
+        struct ScoredMove
         {
-            updateDistanceCache(state);
-
-            const int currentPlayerId = state.currentPlayerId;
-            const int currentIdx = (currentPlayerId == 2) ? 1 : 0;
-            const int opponentIdx = (currentIdx == 0) ? 1 : 0;
+            Move move;
+            int score;
+            int order;
+        };
 
-            const int pawnXSelf = state.pawnX[currentIdx];
-            const int pawnYSelf = state.pawnY[currentIdx];
-            const int pawnXOpp = state.pawnX[opponentIdx];
-            const int pawnYOpp = state.pawnY[opponentIdx];
+        // Order by score, falling back to generation order so results match a stable sort. #
+        bool scoredBefore(const ScoredMove &a, const ScoredMove &b)
+        {
+            if (a.score != b.score)
+                return a.score > b.score;
+            return a.order < b.order;
+        }
 
-            const int16_t currentDist =
-                state.distToGoal[currentIdx][pawnYSelf][pawnXSelf];
+        struct OrderingInfo // Per-node data shared by the move scorers #
+        {
+            int currentIdx = 0;
+            int opponentIdx = 0;
+            int pawnXSelf = 0;
+            int pawnYSelf = 0;
+            int pawnXOpp = 0;
+            int pawnYOpp = 0;
+            int16_t currentDist = -1;
+        };
 
-            struct ScoredMove
-            {
-                Move move;
-                int score;
-                bool wall;
-                bool wallPassesFilter;
-            };
+        // Gather pawn positions and distances for the side to move and its main opponent. #
+        OrderingInfo makeOrderingInfo(GameState &state)
+        {
+            updateDistanceCache(state);
 
-            std::vector<ScoredMove> scoredMoves;
-            std::vector<ScoredMove> wallMoves;
+            OrderingInfo info;
+            info.currentIdx = state.currentPlayerId - 1;
+            info.opponentIdx = strongestOpponent(state, state.currentPlayerId) - 1;
+            info.pawnXSelf = state.pawnX[info.currentIdx];
+            info.pawnYSelf = state.pawnY[info.currentIdx];
+            info.pawnXOpp = state.pawnX[info.opponentIdx];
+            info.pawnYOpp = state.pawnY[info.opponentIdx];
+            info.currentDist = state.distToGoal[info.currentIdx][info.pawnYSelf][info.pawnXSelf];
+            return info;
+        }
 
-            std::vector<Move> moves = generateLegalMoves(state);
-            const bool noWallsRemaining = (state.wallsRemaining[currentIdx] == 0);
+        // Score pawn moves by path gain; out of walls, keep only path-shortening moves if any exist. #
+        int scorePawnMoves(const GameState &state, const OrderingInfo &info, const MoveList &pawnMoves,
+                           ScoredMove out[])
+        {
+            const bool noWallsRemaining = (state.wallsRemaining[info.currentIdx] == 0);
             bool hasReducingPawnMove = false;
-            if (noWallsRemaining && currentDist >= 0)
+            if (noWallsRemaining && info.currentDist >= 0)
             {
-                for (const Move &move : moves)
+                for (const Move &move : pawnMoves)
                 {
-                    if (move.type() != MoveType::PawnMove)
-                        continue;
-
-                    int tx = move.x();
-                    int ty = move.y();
-                    if (!inBoundsCell(tx, ty))
-                        continue;
-
-                    int16_t targetDist = state.distToGoal[currentIdx][ty][tx];
-                    if (targetDist >= 0 && targetDist < currentDist)
+                    int16_t targetDist = state.distToGoal[info.currentIdx][move.y()][move.x()];
+                    if (targetDist >= 0 && targetDist < info.currentDist)
                     {
                         hasReducingPawnMove = true;
                         break;
                     }
                 }
             }
-            scoredMoves.reserve(moves.size());
 
-            for (const Move &move : moves)
+            int count = 0;
+            for (const Move &move : pawnMoves)
             {
-                int score = 0;
-                if (ttBestMove && sameMove(move, *ttBestMove))
-                    score += kTTMoveBonus;
+                int16_t targetDist = -1;
+                if (inBoundsCell(move.x(), move.y()))
+                    targetDist = state.distToGoal[info.currentIdx][move.y()][move.x()];
 
-                if (move.type() == MoveType::PawnMove)
+                if (noWallsRemaining && hasReducingPawnMove)
                 {
-                    int tx = move.x();
-                    int ty = move.y();
-                    int16_t targetDist = -1;
-                    if (inBoundsCell(tx, ty))
-                        targetDist = state.distToGoal[currentIdx][ty][tx];
+                    if (!(info.currentDist >= 0 && targetDist >= 0 && targetDist < info.currentDist))
+                        continue;
+                }
 
-                    if (noWallsRemaining && hasReducingPawnMove)
-                    {
-                        if (!(currentDist >= 0 && targetDist >= 0 && targetDist < currentDist))
-                            continue;
-                    }
+                int score = 0;
+                if (info.currentDist >= 0 && targetDist >= 0)
+                    score += static_cast<int>(info.currentDist - targetDist) * kPawnReduceDistBonus;
 
-                    if (currentDist >= 0 && targetDist >= 0)
-                    {
-                        int improvement = static_cast<int>(currentDist - targetDist);
-                        score += improvement * kPawnReduceDistBonus;
-                    }
-                }
-                else if (move.type() == MoveType::WallPlacement)
-                {
-                    int wx = move.x();
-                    int wy = move.y();
-                    Orientation ori = move.orientation();
+                out[count] = {move, score, count};
+                ++count;
+            }
+            return count;
+        }
 
-                    int blocksOpp = countBlockedReducingEdgesByWall(state, opponentIdx, wx, wy, ori);
-                    int blocksSelf = countBlockedReducingEdgesByWall(state, currentIdx, wx, wy, ori);
+        // Score walls, keep the filtered best kMaxWallMoves in order, and return how many were kept. #
+        int scoreWallMoves(const GameState &state, const OrderingInfo &info, const MoveList &wallMoves,
+                           ScoredMove out[])
+        {
+            ScoredMove allWalls[MoveList::CAPACITY];
+            int wallCount = 0;
+            int filteredCount = 0;
 
-                    score += blocksOpp * kWallBlocksOppBonus;
-                    score -= blocksSelf * kWallBlocksSelfPenalty;
+            for (const Move &move : wallMoves)
+            {
+                int wx = move.x();
+                int wy = move.y();
+                Orientation ori = move.orientation();
 
-                    int distToOpp = wallMinDistanceToPawn(wx, wy, pawnXOpp, pawnYOpp);
-                    int distToSelf = wallMinDistanceToPawn(wx, wy, pawnXSelf, pawnYSelf);
+                int blocksOpp = countBlockedReducingEdgesByWall(state, info.opponentIdx, wx, wy, ori);
+                int blocksSelf = countBlockedReducingEdgesByWall(state, info.currentIdx, wx, wy, ori);
 
-                    if (distToOpp <= kWallCloseRadiusOpp)
-                        score += (kWallCloseRadiusOpp + 1 - distToOpp) * kWallCloseToOppBonus;
+                int score = blocksOpp * kWallBlocksOppBonus - blocksSelf * kWallBlocksSelfPenalty;
 
-                    bool passesFilter =
-                        (blocksOpp > 0) || (distToOpp <= kWallCloseRadiusOpp) || (distToSelf <= kWallCloseRadiusSelf);
+                int distToOpp = wallMinDistanceToPawn(wx, wy, info.pawnXOpp, info.pawnYOpp);
+                int distToSelf = wallMinDistanceToPawn(wx, wy, info.pawnXSelf, info.pawnYSelf);
 
-                    wallMoves.push_back({move, score, true, passesFilter});
-                    continue;
-                }
+                if (distToOpp <= kWallCloseRadiusOpp)
+                    score += (kWallCloseRadiusOpp + 1 - distToOpp) * kWallCloseToOppBonus;
+
+                bool passesFilter =
+                    (blocksOpp > 0) || (distToOpp <= kWallCloseRadiusOpp) || (distToSelf <= kWallCloseRadiusSelf);
 
-                scoredMoves.push_back({move, score, false, true});
+                allWalls[wallCount] = {move, score, wallCount};
+                ++wallCount;
+                if (passesFilter)
+                    out[filteredCount++] = allWalls[wallCount - 1];
             }
 
-            std::vector<ScoredMove> filteredWalls;
-            filteredWalls.reserve(wallMoves.size());
-            for (const auto &wall : wallMoves)
+            if (filteredCount == 0)
             {
-                if (wall.wallPassesFilter)
-                    filteredWalls.push_back(wall);
+                std::copy(allWalls, allWalls + wallCount, out);
+                filteredCount = wallCount;
             }
-            if (filteredWalls.empty())
-                filteredWalls = wallMoves;
 
-            std::stable_sort(filteredWalls.begin(), filteredWalls.end(),
-                             [](const ScoredMove &a, const ScoredMove &b)
-                             { return a.score > b.score; });
-            if (filteredWalls.size() > kMaxWallMoves)
-                filteredWalls.erase(filteredWalls.begin() + static_cast<std::ptrdiff_t>(kMaxWallMoves),
-                                    filteredWalls.end());
+            const int keptWalls = std::min(filteredCount, static_cast<int>(kMaxWallMoves));
+            std::partial_sort(out, out + keptWalls, out + filteredCount, scoredBefore);
+            return keptWalls;
+        }
 
-            scoredMoves.insert(scoredMoves.end(), filteredWalls.begin(), filteredWalls.end());
+        // Generate and order all root moves (pawns and kept walls sorted together). #
+        void generateOrderedMoves(GameState &state, MoveList &ordered)
+        {
+            ordered.clear();
+            const OrderingInfo info = makeOrderingInfo(state);
 
-            std::stable_sort(scoredMoves.begin(), scoredMoves.end(),
-                             [](const ScoredMove &a, const ScoredMove &b)
-                             { return a.score > b.score; });
+            MoveList pawnMoves;
+            MoveList wallMoves;
+            generatePawnMoves(state, pawnMoves);
+            generateWallMoves(state, wallMoves);
 
-            std::vector<Move> ordered;
-            ordered.reserve(scoredMoves.size());
-            for (const auto &entry : scoredMoves)
-                ordered.push_back(entry.move);
-            return ordered;
+            ScoredMove scoredMoves[MoveList::CAPACITY];
+            ScoredMove keptWalls[MoveList::CAPACITY];
+            int scoredCount = scorePawnMoves(state, info, pawnMoves, scoredMoves);
+            const int keptCount = scoreWallMoves(state, info, wallMoves, keptWalls);
+
+            for (int i = 0; i < keptCount; ++i)
+            {
+                scoredMoves[scoredCount] = {keptWalls[i].move, keptWalls[i].score, scoredCount};
+                ++scoredCount;
+            }
+
+            std::sort(scoredMoves, scoredMoves + scoredCount, scoredBefore);
+
+            for (int i = 0; i < scoredCount; ++i)
+                ordered.push(scoredMoves[i].move);
         }
 
-        // Validate a move against current state and rules. #
-        bool isMoveValidForState(const GameState &state, const Move &move)
+        // In a mirror-symmetric position keep one move of each mirrored pair (the left-hand one). #
+        void pruneMirroredMoves(MoveList &moves)
         {
-            int playerId = move.playerId();
-            if (playerId == 0)
-                playerId = state.currentPlayerId;
+            MoveList kept;
+            for (const Move &move : moves)
+            {
+                if (move.x() <= mirrorMove(move).x())
+                    kept.push(move);
+            }
+            moves = kept;
+        }
 
+        // Cheap legality for moves not taken from this node's generator (TT and killer moves). #
+        bool isPseudoLegal(const GameState &state, const Move &move)
+        {
+            if (move.playerId() != state.currentPlayerId)
+                return false;
             if (move.type() == MoveType::PawnMove)
-                return isPawnMoveValid(state, playerId, move.x(), move.y());
-            if (move.type() == MoveType::WallPlacement)
-                return isWallPlacementValid(state, playerId, move.x(), move.y(), move.orientation());
+                return isPawnMoveValid(state, move.playerId(), move.x(), move.y());
+            return state.wallsRemaining[move.playerId() - 1] > 0 &&
+                   isWallPlacementLegalLocal(state.hWalls, state.vWalls, move.x(), move.y(), move.orientation());
+        }
 
-            return false;
+        // Staged move source for interior nodes: TT move, pawn moves, killer walls, then scored walls. #
+        // Later stages are only generated when earlier moves fail to cut off.
+        class MovePicker
+        {
+        public:
+            MovePicker(GameState &state, const SearchContext &ctx, const std::optional<Move> &ttMove)
+                : m_state(state), m_ctx(ctx), m_ttMove(ttMove)
+            {
+            }
+
+            // Produce the next move to search; false once every stage is exhausted. #
+            bool next(Move &move)
+            {
+                switch (m_stage)
+                {
+                case Stage::TTMove:
+                    m_stage = Stage::Pawns;
+                    if (m_ttMove && isPseudoLegal(m_state, *m_ttMove))
+                    {
+                        move = *m_ttMove;
+                        return true;
+                    }
+                    [[fallthrough]];
+
+                case Stage::Pawns:
+                    if (!m_loaded)
+                    {
+                        m_info = makeOrderingInfo(m_state);
+                        MoveList pawnMoves;
+                        generatePawnMoves(m_state, pawnMoves);
+                        m_count = scorePawnMoves(m_state, m_info, pawnMoves, m_moves);
+                        std::sort(m_moves, m_moves + m_count, scoredBefore);
+                        m_index = 0;
+                        m_loaded = true;
+                    }
+                    while (m_index < m_count)
+                    {
+                        const Move &candidate = m_moves[m_index++].move;
+                        if (isTTMove(candidate))
+                            continue;
+                        move = candidate;
+                        return true;
+                    }
+                    m_stage = Stage::Killers;
+                    [[fallthrough]];
+
+                case Stage::Killers:
+                    while (m_killerIndex < kKillerSlots && m_ctx.ply < kMaxSearchPly)
+                    {
+                        const Move &killer = m_ctx.killers[m_ctx.ply][m_killerIndex++];
+                        if (killer.type() != MoveType::WallPlacement || isTTMove(killer) ||
+                            !isPseudoLegal(m_state, killer))
+                            continue;
+                        move = killer;
+                        return true;
+                    }
+                    m_stage = Stage::Walls;
+                    m_loaded = false;
+                    [[fallthrough]];
+
+                case Stage::Walls:
+                    if (!m_loaded)
+                    {
+                        // Restored by the undo stack, so this is normally free.
+                        updateDistanceCache(m_state);
+                        MoveList wallMoves;
+                        generateWallMoves(m_state, wallMoves);
+                        m_count = scoreWallMoves(m_state, m_info, wallMoves, m_moves);
+                        m_index = 0;
+                        m_loaded = true;
+                    }
+                    while (m_index < m_count)
+                    {
+                        const Move &candidate = m_moves[m_index++].move;
+                        if (isTTMove(candidate) || isKiller(candidate))
+                            continue;
+                        move = candidate;
+                        return true;
+                    }
+                    m_stage = Stage::Done;
+                    [[fallthrough]];
+
+                case Stage::Done:
+                    break;
+                }
+                return false;
+            }
+
+        private:
+            enum class Stage
+            {
+                TTMove,
+                Pawns,
+                Killers,
+                Walls,
+                Done
+            };
+
+            // Check if a move was already tried as the TT move. #
+            bool isTTMove(const Move &move) const
+            {
+                return m_ttMove && sameMove(move, *m_ttMove);
+            }
+
+            // Check if a wall was already tried as a killer. #
+            bool isKiller(const Move &move) const
+            {
+                if (m_ctx.ply >= kMaxSearchPly)
+                    return false;
+                for (int i = 0; i < kKillerSlots; ++i)
+                {
+                    const Move &killer = m_ctx.killers[m_ctx.ply][i];
+                    if (killer.type() == MoveType::WallPlacement && sameMove(move, killer))
+                        return true;
+                }
+                return false;
+            }
+
+            GameState &m_state;
+            const SearchContext &m_ctx;
+            std::optional<Move> m_ttMove;
+            Stage m_stage = Stage::TTMove;
+            OrderingInfo m_info;
+            ScoredMove m_moves[MoveList::CAPACITY];
+            int m_count = 0;
+            int m_index = 0;
+            int m_killerIndex = 0;
+            bool m_loaded = false;
+        };
+
+        // Remember a wall that caused a beta cutoff at this ply. #
+        void recordKiller(SearchContext &ctx, const Move &move)
+        {
+            if (move.type() != MoveType::WallPlacement || ctx.ply >= kMaxSearchPly)
+                return;
+            Move *killers = ctx.killers[ctx.ply];
+            if (sameMove(killers[0], move))
+                return;
+            for (int i = kKillerSlots - 1; i > 0; --i)
+                killers[i] = killers[i - 1];
+            killers[0] = move;
         }
 
         // Evaluate terminal positions or fall back to heuristic. #
@@ -382,13 +564,125 @@ namespace Game
             return -kWinScore - depth;
         }
 
-        // Alpha-beta search with time cutoff and transposition table. #
+        // Convert an exact tablebase result into a root-relative search score. #
+        int scoreFromTablebase(const GameState &state, const TablebaseResult &result,
+                               int rootPlayerId, int depth)
+        {
+            if (result.outcome == 0)
+                return 0;
+
+            const int score = kWinScore + depth - result.plies;
+            const bool rootWins = (result.outcome > 0) == (state.currentPlayerId == rootPlayerId);
+            return rootWins ? score : -score;
+        }
+
+        // Check if a repetition is possible here: enough pawn plies since the last wall, or none on the path. #
+        bool mayRepeat(const SearchContext &ctx)
+        {
+            if (ctx.ply > kMaxSearchPly)
+                return false;
+            const int reversible = ctx.reversible[ctx.ply];
+            return reversible >= kMinCyclePlies || (ctx.gameKeys && reversible == ctx.ply);
+        }
+
+        // Look for a key on the search path or in the game history; refPly is the matching ply (-1 for history). #
+        // A wall changes the key for good, so the scan stops at the last one.
+        bool isRepetition(const SearchContext &ctx, uint64_t key, int &refPly)
+        {
+            const int reversible = ctx.reversible[ctx.ply];
+            const int oldest = std::max(0, ctx.ply - reversible);
+            for (int i = ctx.ply - kMinCyclePlies; i >= oldest; --i)
+            {
+                if (ctx.pathKeys[i] == key)
+                {
+                    refPly = i;
+                    return true;
+                }
+            }
+
+            if (ctx.gameKeys && reversible == ctx.ply &&
+                std::binary_search(ctx.gameKeys->begin(), ctx.gameKeys->end(), key))
+            {
+                refPly = -1;
+                return true;
+            }
+            return false;
+        }
+
+        // Apply a search move; a wall saves the parent's clean distance grids so undo can restore them. #
+        bool applySearchMove(GameState &state, const Move &move, MoveUndoState &undo, SearchContext &ctx)
+        {
+            const bool saveDist = move.type() == MoveType::WallPlacement && state.distDirty == 0 &&
+                                  ctx.ply < kMaxSearchPly;
+            if (saveDist)
+                std::memcpy(ctx.distStack[ctx.ply], state.distToGoal, sizeof(state.distToGoal[0]) * playerCount(state));
+            if (!applyMoveUnchecked(state, move, undo))
+                return false;
+            if (ctx.ply < kMaxSearchPly)
+            {
+                ctx.distSaved[ctx.ply] = saveDist;
+                ctx.reversible[ctx.ply + 1] =
+                    move.type() == MoveType::WallPlacement ? 0 : ctx.reversible[ctx.ply] + 1;
+            }
+            ++ctx.ply;
+            return true;
+        }
+
+        // Undo a search move, restoring saved distance grids instead of marking them dirty. #
+        void undoSearchMove(GameState &state, const Move &move, const MoveUndoState &undo, SearchContext &ctx)
+        {
+            --ctx.ply;
+            undoMove(state, move, undo);
+            if (ctx.ply < kMaxSearchPly && ctx.distSaved[ctx.ply])
+            {
+                std::memcpy(state.distToGoal, ctx.distStack[ctx.ply], sizeof(state.distToGoal[0]) * playerCount(state));
+                state.distDirty = 0;
+            }
+        }
+
+        // Validate and apply a generated move; a wall's path check reuses the child's distance BFS. #
+        bool tryApplySearchMove(GameState &state, const Move &move, MoveUndoState &undo, SearchContext &ctx)
+        {
+            int playerId = move.playerId();
+            if (playerId == 0)
+                playerId = state.currentPlayerId;
+
+            if (move.type() == MoveType::PawnMove)
+            {
+                if (!isPawnMoveValid(state, playerId, move.x(), move.y()))
+                    return false;
+                return applySearchMove(state, move, undo, ctx);
+            }
+
+            if (playerId < 1 || playerId > playerCount(state) || state.wallsRemaining[playerId - 1] == 0)
+                return false;
+            if (!isWallPlacementLegalLocal(state.hWalls, state.vWalls, move.x(), move.y(), move.orientation()))
+                return false;
+            if (!applySearchMove(state, move, undo, ctx))
+                return false;
+
+            updateDistanceCache(state);
+            const int seats = playerCount(state);
+            for (int i = 0; i < seats; ++i)
+            {
+                if (state.distToGoal[i][state.pawnY[i]][state.pawnX[i]] < 0)
+                {
+                    undoSearchMove(state, move, undo, ctx);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Alpha-beta search with time/node cutoff and transposition table. #
         int alphaBeta(GameState &state, int depth, int alpha, int beta, SearchContext &ctx)
         {
             if (ctx.timeUp)
                 return evaluateHeuristic(state, *ctx.config, ctx.rootPlayerId);
 
-            if (std::chrono::steady_clock::now() >= ctx.deadline)
+            if ((ctx.maxNodes > 0 && ctx.nodes >= ctx.maxNodes) ||
+                (ctx.stop && ctx.stop->load(std::memory_order_relaxed)) ||
+                (ctx.useClock && std::chrono::steady_clock::now() >= ctx.deadline))
             {
                 ctx.timeUp = true;
                 return evaluateHeuristic(state, *ctx.config, ctx.rootPlayerId);
@@ -396,17 +690,43 @@ namespace Game
 
             ctx.nodes++;
 
-            if (depth <= 0 || state.winnerId != 0)
+            if (state.winnerId == 0 && ctx.tablebase)
+            {
+                TablebaseResult result;
+                if (ctx.tablebase->probe(state, result))
+                    return scoreFromTablebase(state, result, ctx.rootPlayerId, depth);
+            }
+
+            if (state.winnerId != 0)
+                return evaluateTerminal(state, *ctx.config, ctx.rootPlayerId, depth);
+
+            ZobristKeys keys;
+            const bool checkRepetition = mayRepeat(ctx);
+            if (depth > 0 || checkRepetition)
+            {
+                keys = computeZobristKeys(state);
+                int refPly = 0;
+                if (checkRepetition && isRepetition(ctx, keys.key, refPly))
+                {
+                    ctx.repetitionRef = std::min(ctx.repetitionRef, refPly);
+                    return -ctx.config->contempt;
+                }
+                if (ctx.ply <= kMaxSearchPly)
+                    ctx.pathKeys[ctx.ply] = keys.key;
+            }
+
+            if (depth <= 0)
                 return evaluateTerminal(state, *ctx.config, ctx.rootPlayerId, depth);
 
-            const uint64_t key = computeZobrist(state);
+            // Mirror images share one entry; moves are stored in the canonical orientation.
+            const uint64_t key = keys.canonical();
             std::optional<Move> ttMove;
             const TTEntry *entry = nullptr;
             if (ctx.tt)
             {
                 entry = ctx.tt->probe(key);
                 if (entry && entry->bestMove)
-                    ttMove = *entry->bestMove;
+                    ttMove = keys.mirrored() ? mirrorMove(*entry->bestMove) : *entry->bestMove;
 
                 if (entry)
                 {
@@ -424,31 +744,35 @@ namespace Game
                 }
             }
 
-            std::vector<Move> moves = generateOrderedMoves(state, ctx, ttMove);
-            if (moves.empty())
-                return evaluateTerminal(state, *ctx.config, ctx.rootPlayerId, depth);
+            MovePicker picker(state, ctx, ttMove);
 
             const int alphaOrig = alpha;
             const int betaOrig = beta;
 
+            // Paranoid search: with more than two seats every other player minimizes for the root.
             const bool maximizing = (state.currentPlayerId == ctx.rootPlayerId);
             int bestValue = maximizing ? std::numeric_limits<int>::min() : std::numeric_limits<int>::max();
-            Move bestMove = moves.front();
+            Move bestMove;
+            int searched = 0;
 
-            for (const Move &move : moves)
+            // Values that rely on a repetition above this node depend on the path, so they stay out of the TT.
+            const int outerRepetitionRef = ctx.repetitionRef;
+            ctx.repetitionRef = kNoRepetition;
+
+            Move move;
+            while (picker.next(move))
             {
                 if (ctx.timeUp)
                     break;
 
-                if (!isMoveValidForState(state, move))
-                    continue;
-
                 MoveUndoState undo{};
-                if (!applyMoveUnchecked(state, move, undo))
+                if (!tryApplySearchMove(state, move, undo, ctx))
                     continue;
 
                 int value = alphaBeta(state, depth - 1, alpha, beta, ctx);
-                undoMove(state, move, undo);
+                undoSearchMove(state, move, undo, ctx);
+                if (searched++ == 0)
+                    bestMove = move;
 
                 if (maximizing)
                 {
@@ -470,10 +794,19 @@ namespace Game
                 }
 
                 if (beta <= alpha)
+                {
+                    recordKiller(ctx, move);
                     break;
+                }
             }
 
-            if (!ctx.timeUp && ctx.tt)
+            const bool pathDependent = ctx.repetitionRef < ctx.ply;
+            ctx.repetitionRef = std::min(outerRepetitionRef, ctx.repetitionRef);
+
+            if (searched == 0)
+                return evaluateTerminal(state, *ctx.config, ctx.rootPlayerId, depth);
+
+            if (!ctx.timeUp && ctx.tt && !pathDependent)
             {
                 TTFlag flag = TTFlag::Exact;
                 if (bestValue <= alphaOrig)
@@ -481,16 +814,56 @@ namespace Game
                 else if (bestValue >= betaOrig)
                     flag = TTFlag::LowerBound;
 
-                ctx.tt->store(key, depth, bestValue, flag, bestMove);
+                ctx.tt->store(key, depth, bestValue, flag, keys.mirrored() ? mirrorMove(bestMove) : bestMove);
             }
 
             return bestValue;
         }
     }
 
+    namespace
+    {
+        // Follow best moves stored in the table from the root to rebuild the expected line. #
+        void collectPrincipalVariation(GameState state, const Move &first, const TranspositionTable &tt,
+                                       int maxLength, std::vector<Move> &pv)
+        {
+            pv.clear();
+            Move move = first;
+            while (static_cast<int>(pv.size()) < maxLength && applyMove(state, move))
+            {
+                pv.push_back(move);
+                if (state.winnerId != 0)
+                    break;
+
+                const ZobristKeys keys = computeZobristKeys(state);
+                const TTEntry *entry = tt.probe(keys.canonical());
+                if (!entry || !entry->bestMove)
+                    break;
+                move = keys.mirrored() ? mirrorMove(*entry->bestMove) : *entry->bestMove;
+            }
+        }
+    }
+
+    // Evaluation terms for a player against the opponent closest to its goal. #
+    EvaluationFeatures evaluationFeatures(GameState &state, int perspectivePlayerId)
+    {
+        updateDistanceCache(state);
+        if (perspectivePlayerId < 1 || perspectivePlayerId > playerCount(state))
+            return EvaluationFeatures{};
+        return featuresAgainst(state, perspectivePlayerId - 1, strongestOpponent(state, perspectivePlayerId) - 1);
+    }
+
+    // Combine evaluation terms with the config weights. #
+    int weightedEvaluation(const EvaluationFeatures &features, const HeuristicSearchConfig &config)
+    {
+        return features.distance * config.weightDistance +
+               features.walls * config.weightWalls +
+               features.width * config.weightWidth;
+    }
+
     // Initialize engine with config and TT size. #
-    HeuristicEngine::HeuristicEngine(HeuristicSearchConfig config)
-        : m_config(config), m_tt(1 << 20)
+    HeuristicEngine::HeuristicEngine(HeuristicSearchConfig config, size_t ttEntries)
+        : m_config(config), m_tt(ttEntries)
     {
     }
 
@@ -506,55 +879,179 @@ namespace Game
         return m_config;
     }
 
-    // Search for the best move from the given state. #
-    Move HeuristicEngine::findBestMove(const GameState &state)
+    // Access statistics of the most recent search. #
+    const HeuristicSearchInfo &HeuristicEngine::lastSearchInfo() const
+    {
+        return m_lastInfo;
+    }
+
+    // Use an external flag (owned by the caller) to end searches early. #
+    void HeuristicEngine::setStopFlag(const std::atomic<bool> *stop)
+    {
+        m_stop = stop;
+    }
+
+    // Install a callback that receives the statistics of each completed iteration. #
+    void HeuristicEngine::setInfoCallback(SearchInfoCallback callback)
+    {
+        m_infoCallback = std::move(callback);
+    }
+
+    // Search for the best move from the given state; positions in history count as repetitions. #
+    Move HeuristicEngine::findBestMove(const GameState &state, const std::vector<ZobristKeys> &history)
     {
         GameState working = state;
+        const auto start = std::chrono::steady_clock::now();
 
         m_tt.clear();
+        m_lastInfo = HeuristicSearchInfo{};
 
         SearchContext ctx{};
         ctx.config = &m_config;
         ctx.tt = &m_tt;
         ctx.rootPlayerId = state.currentPlayerId;
-        ctx.deadline = std::chrono::steady_clock::now() +
-                       std::chrono::milliseconds(m_config.timeLimitMs);
+        ctx.maxNodes = m_config.maxNodes;
+        ctx.useClock = !m_config.deterministic;
+        ctx.stop = m_stop;
+        const ZobristKeys rootKeys = computeZobristKeys(state);
+        ctx.pathKeys[0] = rootKeys.key;
+
+        std::vector<uint64_t> gameKeys;
+        gameKeys.reserve(history.size());
+        for (const ZobristKeys &keys : history)
+            gameKeys.push_back(keys.key);
+        std::sort(gameKeys.begin(), gameKeys.end());
+        if (!gameKeys.empty())
+            ctx.gameKeys = &gameKeys;
+
+        // Mirrored root moves are interchangeable only if the history holds the mirror of every position.
+        const bool historySymmetric = std::all_of(history.begin(), history.end(), [&](const ZobristKeys &keys)
+                                                  { return std::binary_search(gameKeys.begin(), gameKeys.end(), keys.mirrorKey); });
+
+        TimeManager timer;
+        if (ctx.useClock)
+            timer.start(m_config, working);
+
+        if (m_config.tablebaseMaxWalls >= 0 &&
+            EndgameTablebase::covers(state, m_config.tablebaseMaxWalls))
+        {
+            // Table generation may not eat into the search: it stops at the stop flag or after a share of
+            // the soft limit. Probing stays on, since it only reads complete tables already in memory.
+            const auto prepareDeadline = start + std::chrono::milliseconds(timer.softLimitMs() / kTablebaseBudgetDivisor);
+            m_tablebase.setStorageDirectory(m_config.tablebasePath);
+            m_tablebase.prepare(state, [&]()
+                                { return (m_stop && m_stop->load(std::memory_order_relaxed)) ||
+                                         (ctx.useClock && std::chrono::steady_clock::now() >= prepareDeadline); });
+            ctx.tablebase = &m_tablebase;
+        }
 
-        std::vector<Move> moves = generateOrderedMoves(working, ctx, std::nullopt);
+        MoveList moves;
+        generateOrderedMoves(working, moves);
+        if (rootKeys.symmetric() && historySymmetric)
+            pruneMirroredMoves(moves);
         if (moves.empty())
         {
             int playerId = state.currentPlayerId;
-            int idx = (playerId == 2) ? 1 : 0;
+            int idx = playerId - 1;
             return Move::Pawn(state.pawnX[idx], state.pawnY[idx], playerId);
         }
+        if (moves.size == 1)
+        {
+            m_lastInfo.pv.assign(1, moves[0]);
+            return moves[0];
+        }
+
+        // The clock is only armed once depth 1 is complete, so every search returns a searched move.
+        const auto deadline = start + std::chrono::milliseconds(timer.hardLimitMs());
+        ctx.deadline = std::chrono::steady_clock::time_point::max();
 
         int bestScore = std::numeric_limits<int>::min();
-        Move bestMove = moves.front();
+        Move bestMove = moves[0];
+        m_lastInfo.depth = 0;
 
-        for (const Move &move : moves)
+        // Iterative deepening: each pass searches the previous best move first, so a pass cut short by
+        // the clock still returns a move at least as well informed as the last complete one.
+        for (int depth = 1; depth <= m_config.maxDepth; ++depth)
         {
+            int iterationScore = std::numeric_limits<int>::min();
+            Move iterationBest = bestMove;
+
+            for (const Move &move : moves)
+            {
+                if (ctx.timeUp)
+                    break;
+
+                MoveUndoState undo{};
+                if (!tryApplySearchMove(working, move, undo, ctx))
+                    continue;
+
+                int value = alphaBeta(working, depth - 1, iterationScore,
+                                      std::numeric_limits<int>::max(), ctx);
+                undoSearchMove(working, move, undo, ctx);
+                if (ctx.timeUp)
+                    break;
+
+                if (value > iterationScore)
+                {
+                    iterationScore = value;
+                    iterationBest = move;
+                }
+            }
+
+            if (iterationScore == std::numeric_limits<int>::min())
+                break;
+            bestScore = iterationScore;
+            bestMove = iterationBest;
             if (ctx.timeUp)
                 break;
+            m_lastInfo.depth = depth;
+            ctx.deadline = deadline;
 
-            if (!isMoveValidForState(working, move))
-                continue;
-
-            MoveUndoState undo{};
-            if (!applyMoveUnchecked(working, move, undo))
-                continue;
+            if (m_infoCallback)
+            {
+                HeuristicSearchInfo info;
+                info.score = bestScore;
+                info.depth = depth;
+                info.nodes = ctx.nodes;
+                info.elapsedMs = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                      std::chrono::steady_clock::now() - start)
+                                                      .count());
+                collectPrincipalVariation(state, bestMove, m_tt, depth, info.pv);
+                m_infoCallback(info);
+            }
 
-            int value = alphaBeta(working, m_config.maxDepth - 1,
-                                  std::numeric_limits<int>::min(),
-                                  std::numeric_limits<int>::max(), ctx);
-            undoMove(working, move, undo);
+            for (int i = 0; i < moves.size; ++i)
+            {
+                if (sameMove(moves.moves[i], bestMove))
+                {
+                    std::rotate(moves.moves, moves.moves + i, moves.moves + i + 1);
+                    break;
+                }
+            }
 
-            if (value > bestScore)
+            // A forced result does not change with more depth.
+            if (std::abs(bestScore) >= kWinScore / 2)
+                break;
+            if (ctx.useClock)
             {
-                bestScore = value;
-                bestMove = move;
+                timer.onIteration(bestMove, bestScore);
+                const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start);
+                if (timer.shouldStop(static_cast<int>(elapsed.count())))
+                    break;
             }
         }
 
+        // A stop before any root move was searched leaves no score; report the static one instead.
+        if (bestScore == std::numeric_limits<int>::min())
+            bestScore = evaluateHeuristic(working, m_config, state.currentPlayerId);
+        m_lastInfo.score = bestScore;
+        m_lastInfo.nodes = ctx.nodes;
+        m_lastInfo.timedOut = ctx.timeUp;
+        collectPrincipalVariation(state, bestMove, m_tt, std::max(1, m_lastInfo.depth), m_lastInfo.pv);
+        m_lastInfo.elapsedMs = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                    std::chrono::steady_clock::now() - start)
+                                                    .count());
         return bestMove;
     }
 }
@@ -0,0 +1,104 @@
+#include "heuristic/TimeManager.hpp"
+#include "game/GameRules.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace Game
+{
+    namespace
+    {
+        constexpr int kMinMovesToGo = 4; // Keep a reserve even when the goal is near #
+        constexpr int kMaxMovesToGo = 40;
+        constexpr int kHardToSoftRatio = 4; // Hard limit as a multiple of the soft one #
+        constexpr int kMoveOverheadMs = 30; // Left on the clock for scheduling and UI #
+        constexpr int kMinMoveMs = 10;
+    }
+
+    // Use a fixed move time, split the clock over the expected remaining moves, or use timeLimitMs. #
+    void TimeManager::start(const HeuristicSearchConfig &config, GameState &state)
+    {
+        *this = TimeManager{};
+        m_swingScore = 2 * config.weightDistance;
+
+        if (config.moveTimeMs > 0)
+        {
+            m_fixed = true;
+            m_softMs = m_hardMs = std::max(kMinMoveMs, config.moveTimeMs);
+            return;
+        }
+
+        updateDistanceCache(state);
+        const int seats = playerCount(state);
+        const int myIdx = state.currentPlayerId - 1;
+        const int myDist = std::max<int>(0, state.distToGoal[myIdx][state.pawnY[myIdx]][state.pawnX[myIdx]]);
+        int totalWalls = 0;
+        for (int i = 0; i < seats; ++i)
+            totalWalls += state.wallsRemaining[i];
+
+        if (config.clockMs > 0)
+        {
+            // Walls still in hand lengthen the game: each one is a move and usually a detour.
+            const int movesToGo = std::clamp(myDist + totalWalls / 2, kMinMovesToGo, kMaxMovesToGo);
+            m_softMs = config.clockMs / movesToGo + config.incrementMs * 3 / 4;
+            m_hardMs = std::min(m_softMs * kHardToSoftRatio, config.clockMs / 3 + config.incrementMs);
+            m_hardMs = std::min(m_hardMs, config.clockMs - kMoveOverheadMs);
+        }
+        else
+        {
+            m_hardMs = config.timeLimitMs;
+            m_softMs = config.timeLimitMs / 3;
+        }
+
+        // Without walls the game is a pawn race: distances (or endgame tables) settle it quickly.
+        if (totalWalls == 0)
+            m_softMs /= 2;
+
+        m_hardMs = std::max(kMinMoveMs, m_hardMs);
+        m_softMs = std::clamp(m_softMs, kMinMoveMs, m_hardMs);
+    }
+
+    // Track best-move stability and score swings between iterations. #
+    void TimeManager::onIteration(const Move &bestMove, int score)
+    {
+        if (m_iterations > 0)
+        {
+            m_bestChanged = !sameMove(bestMove, m_lastBest);
+            m_stableIterations = m_bestChanged ? 0 : m_stableIterations + 1;
+            m_scoreSwing = std::abs(score - m_lastScore) >= m_swingScore;
+        }
+        m_lastBest = bestMove;
+        m_lastScore = score;
+        ++m_iterations;
+    }
+
+    // Stretch the soft limit while the search is unsettled and shrink it once the best move holds. #
+    bool TimeManager::shouldStop(int elapsedMs) const
+    {
+        if (m_fixed)
+            return elapsedMs >= m_hardMs;
+
+        double scale = 1.0;
+        if (m_bestChanged)
+            scale *= 1.5;
+        if (m_scoreSwing)
+            scale *= 1.3;
+        if (m_stableIterations >= 2)
+            scale *= 0.6;
+
+        const int limit = std::min(m_hardMs, static_cast<int>(m_softMs * scale));
+        return elapsedMs >= limit;
+    }
+
+    // Access the soft limit. #
+    int TimeManager::softLimitMs() const
+    {
+        return m_softMs;
+    }
+
+    // Access the hard limit. #
+    int TimeManager::hardLimitMs() const
+    {
+        return m_hardMs;
+    }
+}
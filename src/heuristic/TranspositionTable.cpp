@@ -1,4 +1,5 @@
 #include "heuristic/TranspositionTable.hpp"
+#include "game/GameRules.hpp"
 #include <algorithm>
 #include <random>
 
@@ -25,12 +26,12 @@ namespace Game
         // Random tables for Zobrist hasing. #
         struct ZobristTables
         {
-            uint64_t pawn[2][GameState::BOARD_SIZE][GameState::BOARD_SIZE];
+            uint64_t pawn[GameState::MAX_PLAYERS][GameState::BOARD_SIZE][GameState::BOARD_SIZE];
             uint64_t hWall[GameState::WALL_GRID][GameState::WALL_GRID];
             uint64_t vWall[GameState::WALL_GRID][GameState::WALL_GRID];
-            uint64_t wallsRemaining[2][GameState::MAX_WALLS_PER_PLAYER + 1];
-            uint64_t currentPlayer[2];
-            uint64_t winner[3];
+            uint64_t wallsRemaining[GameState::MAX_PLAYERS][GameState::MAX_WALLS_PER_PLAYER + 1];
+            uint64_t currentPlayer[GameState::MAX_PLAYERS];
+            uint64_t winner[GameState::MAX_PLAYERS + 1];
         };
 
         // Initialize and return shared Zobrist tables. #
@@ -78,6 +79,26 @@ namespace Game
                 t.winner[1] = next();
                 t.winner[2] = next();
 
+                // Seats 3-4 are drawn last so two-player keys keep their values.
+                for (int p = 2; p < GameState::MAX_PLAYERS; ++p)
+                {
+                    for (int y = 0; y < GameState::BOARD_SIZE; ++y)
+                    {
+                        for (int x = 0; x < GameState::BOARD_SIZE; ++x)
+                        {
+                            t.pawn[p][y][x] = next();
+                        }
+                    }
+
+                    for (int w = 0; w <= GameState::MAX_WALLS_PER_PLAYER; ++w)
+                    {
+                        t.wallsRemaining[p][w] = next();
+                    }
+
+                    t.currentPlayer[p] = next();
+                    t.winner[p + 1] = next();
+                }
+
                 return t;
             }();
 
@@ -87,23 +108,35 @@ namespace Game
 
     // Compute a Zobrist has for the logical game state. #
     uint64_t computeZobrist(const GameState &state)
+    {
+        return computeZobristKeys(state).key;
+    }
+
+    // Hash the state and its mirror together; files x map to 8 - x and wall anchors to 7 - x. #
+    ZobristKeys computeZobristKeys(const GameState &state)
     {
         const ZobristTables &t = tables();
+        constexpr int kLastCell = GameState::BOARD_SIZE - 1;
+        constexpr int kLastAnchor = GameState::WALL_GRID - 1;
         uint64_t has = 0;
+        uint64_t mirror = 0;
 
-        for (int p = 0; p < 2; ++p)
+        const int seats = playerCount(state);
+        for (int p = 0; p < seats; ++p)
         {
             int x = state.pawnX[p];
             int y = state.pawnY[p];
             if (x >= 0 && x < GameState::BOARD_SIZE && y >= 0 && y < GameState::BOARD_SIZE)
             {
                 has ^= t.pawn[p][y][x];
+                mirror ^= t.pawn[p][y][kLastCell - x];
             }
 
             int walls = state.wallsRemaining[p];
             if (walls >= 0 && walls <= GameState::MAX_WALLS_PER_PLAYER)
             {
                 has ^= t.wallsRemaining[p][walls];
+                mirror ^= t.wallsRemaining[p][walls];
             }
         }
 
@@ -112,19 +145,39 @@ namespace Game
             for (int x = 0; x < GameState::WALL_GRID; ++x)
             {
                 if (state.hWalls[x][y])
+                {
                     has ^= t.hWall[x][y];
+                    mirror ^= t.hWall[kLastAnchor - x][y];
+                }
                 if (state.vWalls[x][y])
+                {
                     has ^= t.vWall[x][y];
+                    mirror ^= t.vWall[kLastAnchor - x][y];
+                }
             }
         }
 
-        if (state.currentPlayerId == 1 || state.currentPlayerId == 2)
-            has ^= t.currentPlayer[state.currentPlayerId - 1];
+        uint64_t shared = 0;
+        if (state.currentPlayerId >= 1 && state.currentPlayerId <= seats)
+            shared ^= t.currentPlayer[state.currentPlayerId - 1];
 
-        if (state.winnerId <= 2)
-            has ^= t.winner[state.winnerId];
+        if (state.winnerId <= seats)
+            shared ^= t.winner[state.winnerId];
 
-        return has;
+        ZobristKeys keys;
+        keys.key = has ^ shared;
+        // Seats 3-4 race across files, so a reflected four-player game is a different position.
+        keys.mirrorable = (seats == 2);
+        keys.mirrorKey = keys.mirrorable ? (mirror ^ shared) : keys.key;
+        return keys;
+    }
+
+    // Reflect a move about the central file. #
+    Move mirrorMove(const Move &move)
+    {
+        if (move.type() == MoveType::PawnMove)
+            return Move::Pawn(GameState::BOARD_SIZE - 1 - move.x(), move.y(), move.playerId());
+        return Move::Wall(GameState::WALL_GRID - 1 - move.x(), move.y(), move.orientation(), move.playerId());
     }
 
     // Create a table with size rounded to power-of-two. #
@@ -0,0 +1,295 @@
+#include "ui/AssetLoader.hpp"
+#include "ui/ResourceCache.hpp"
+#include <algorithm>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace UI
+{
+    namespace
+    {
+        constexpr char kPcmMagic[4] = {'Q', 'P', 'C', 'M'};
+        constexpr std::uint32_t kPcmVersion = 1;
+
+        // Milliseconds elapsed since a time point. #
+        double millisecondsSince(std::chrono::steady_clock::time_point start)
+        {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Write one value in host byte order (the cache is only used on little-endian hosts). #
+        template <typename T>
+        void writeRaw(std::ofstream &out, T value)
+        {
+            out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        // Read one value in host byte order. #
+        template <typename T>
+        bool readRaw(std::ifstream &in, T &value)
+        {
+            return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+        }
+
+        // Cache file for a source sound, flattened into one directory. #
+        std::filesystem::path pcmCachePath(const std::string &source)
+        {
+            std::string name = std::filesystem::path(source).generic_string();
+            std::replace(name.begin(), name.end(), '/', '_');
+            return std::filesystem::path(AssetLoader::PCM_CACHE_DIRECTORY) / (name + ".pcm");
+        }
+
+        // Size and modification time that a cache entry must match. #
+        bool sourceStamp(const std::string &source, std::uint64_t &size, std::int64_t &time)
+        {
+            std::error_code ec;
+            size = std::filesystem::file_size(source, ec);
+            if (ec)
+                return false;
+            time = static_cast<std::int64_t>(std::filesystem::last_write_time(source, ec).time_since_epoch().count());
+            return !ec;
+        }
+
+        // Read samples cached for an unchanged source; the data is one bulk read, no decoding. #
+        bool loadPcmCache(const std::string &source, DecodedSound &sound)
+        {
+            std::uint64_t size = 0;
+            std::int64_t time = 0;
+            if (std::endian::native != std::endian::little || !sourceStamp(source, size, time))
+                return false;
+
+            std::ifstream in(pcmCachePath(source), std::ios::binary);
+            if (!in)
+                return false;
+
+            char magic[4] = {};
+            std::uint32_t version = 0, channelMapSize = 0;
+            std::uint64_t cachedSize = 0, sampleCount = 0;
+            std::int64_t cachedTime = 0;
+            in.read(magic, sizeof(magic));
+            if (!in || !std::equal(magic, magic + 4, kPcmMagic) || !readRaw(in, version) || version != kPcmVersion ||
+                !readRaw(in, cachedSize) || !readRaw(in, cachedTime) || cachedSize != size || cachedTime != time ||
+                !readRaw(in, sound.sampleRate) || !readRaw(in, sound.channelCount) || !readRaw(in, channelMapSize))
+                return false;
+
+            sound.channelMap.clear();
+            for (std::uint32_t i = 0; i < channelMapSize; ++i)
+            {
+                std::uint32_t channel = 0;
+                if (!readRaw(in, channel))
+                    return false;
+                sound.channelMap.push_back(static_cast<sf::SoundChannel>(channel));
+            }
+
+            if (!readRaw(in, sampleCount) || sampleCount == 0)
+                return false;
+            sound.samples.resize(static_cast<std::size_t>(sampleCount));
+            return static_cast<bool>(in.read(reinterpret_cast<char *>(sound.samples.data()),
+                                             static_cast<std::streamsize>(sampleCount * sizeof(std::int16_t))));
+        }
+
+        // Store decoded samples next to a stamp of their source. #
+        void savePcmCache(const std::string &source, const DecodedSound &sound)
+        {
+            std::uint64_t size = 0;
+            std::int64_t time = 0;
+            if (std::endian::native != std::endian::little || !sourceStamp(source, size, time))
+                return;
+
+            std::error_code ec;
+            std::filesystem::create_directories(AssetLoader::PCM_CACHE_DIRECTORY, ec);
+
+            // Write to a private temp file and rename, so a concurrent launch never reads a partial file.
+            const std::filesystem::path finalPath = pcmCachePath(source);
+            std::ostringstream tempName;
+            tempName << finalPath.string() << ".tmp" << std::this_thread::get_id();
+            const std::string tempPath = tempName.str();
+
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (!out)
+            {
+                std::cerr << "Failed to write PCM cache: " << finalPath.string() << "\n";
+                return;
+            }
+            out.write(kPcmMagic, sizeof(kPcmMagic));
+            writeRaw(out, kPcmVersion);
+            writeRaw(out, size);
+            writeRaw(out, time);
+            writeRaw(out, sound.sampleRate);
+            writeRaw(out, sound.channelCount);
+            writeRaw(out, static_cast<std::uint32_t>(sound.channelMap.size()));
+            for (sf::SoundChannel channel : sound.channelMap)
+                writeRaw(out, static_cast<std::uint32_t>(channel));
+            writeRaw(out, static_cast<std::uint64_t>(sound.samples.size()));
+            out.write(reinterpret_cast<const char *>(sound.samples.data()),
+                      static_cast<std::streamsize>(sound.samples.size() * sizeof(std::int16_t)));
+            out.close();
+
+            std::filesystem::rename(tempPath, finalPath, ec);
+            if (ec)
+                std::filesystem::remove(tempPath, ec);
+        }
+    }
+
+    // Join workers so no thread outlives the queue it reads. #
+    AssetLoader::~AssetLoader()
+    {
+        for (std::thread &worker : m_workers)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+    }
+
+    // Queue an image decode. #
+    void AssetLoader::addImage(const std::string &path)
+    {
+        m_jobs.push_back({path, false});
+    }
+
+    // Queue a sound decode. #
+    void AssetLoader::addSound(const std::string &path)
+    {
+        m_jobs.push_back({path, true});
+    }
+
+    // Launch up to one worker per queued asset. #
+    void AssetLoader::start(unsigned int threads)
+    {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = std::min<unsigned int>(threads, static_cast<unsigned int>(m_jobs.size()));
+
+        m_startTime = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < threads; ++i)
+            m_workers.emplace_back(&AssetLoader::work, this, i);
+    }
+
+    // Decode jobs in claim order; only the finished list is shared with the main thread. #
+    void AssetLoader::work(unsigned int worker)
+    {
+        for (std::size_t index = m_nextJob.fetch_add(1); index < m_jobs.size(); index = m_nextJob.fetch_add(1))
+        {
+            const auto start = std::chrono::steady_clock::now();
+            Result result;
+            result.job = index;
+            result.worker = worker;
+
+            if (m_jobs[index].isSound)
+            {
+                auto sound = std::make_shared<DecodedSound>();
+                if (decodeSound(m_jobs[index].path, *sound))
+                    result.sound = std::move(sound);
+            }
+            else
+            {
+                auto image = std::make_shared<sf::Image>();
+                if (image->loadFromFile(m_jobs[index].path))
+                    result.image = std::move(image);
+            }
+            result.decodeMs = millisecondsSince(start);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished.push_back(std::move(result));
+        }
+    }
+
+    // Adopt finished assets; sound buffers are built here, textures upload when a screen asks for them. #
+    std::size_t AssetLoader::collect()
+    {
+        std::vector<Result> finished;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            finished.swap(m_finished);
+        }
+
+        ResourceCache &cache = ResourceCache::instance();
+        for (Result &result : finished)
+        {
+            const std::string &path = m_jobs[result.job].path;
+            const auto start = std::chrono::steady_clock::now();
+            bool loaded = false;
+            if (result.image)
+            {
+                cache.store(path, std::shared_ptr<const sf::Image>(std::move(result.image)));
+                loaded = true;
+            }
+            else if (result.sound)
+            {
+                auto buffer = std::make_shared<sf::SoundBuffer>();
+                const DecodedSound &sound = *result.sound;
+                if (buffer->loadFromSamples(sound.samples.data(), sound.samples.size(), sound.channelCount,
+                                            sound.sampleRate, sound.channelMap))
+                {
+                    cache.store(path, std::shared_ptr<const sf::SoundBuffer>(std::move(buffer)));
+                    loaded = true;
+                }
+            }
+
+            if (!loaded)
+            {
+                std::cerr << "Failed to decode " << path << "\n";
+                continue;
+            }
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(1) << "Loaded " << path << " in " << result.decodeMs
+                 << " ms (worker " << result.worker << "), adopted in " << millisecondsSince(start) << " ms\n";
+            std::cout << line.str();
+        }
+
+        m_collected += finished.size();
+        if (!finished.empty() && isDone())
+        {
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(1) << "Decoded " << m_jobs.size() << " assets on "
+                 << m_workers.size() << " threads in " << millisecondsSince(m_startTime) << " ms\n";
+            std::cout << line.str();
+        }
+        return finished.size();
+    }
+
+    // Queued assets. #
+    std::size_t AssetLoader::total() const
+    {
+        return m_jobs.size();
+    }
+
+    // Assets already handed to the cache. #
+    std::size_t AssetLoader::collected() const
+    {
+        return m_collected;
+    }
+
+    // Every queued asset was collected. #
+    bool AssetLoader::isDone() const
+    {
+        return m_collected == m_jobs.size();
+    }
+
+    // Read a whole sound file as interleaved 16-bit samples, from the PCM cache when it is current. #
+    bool AssetLoader::decodeSound(const std::string &path, DecodedSound &sound)
+    {
+        if (loadPcmCache(path, sound))
+            return true;
+
+        sf::InputSoundFile file;
+        if (!file.openFromFile(path))
+            return false;
+
+        sound.channelCount = file.getChannelCount();
+        sound.sampleRate = file.getSampleRate();
+        sound.channelMap = file.getChannelMap();
+        sound.samples.resize(static_cast<std::size_t>(file.getSampleCount()));
+        const std::uint64_t read = file.read(sound.samples.data(), sound.samples.size());
+        sound.samples.resize(static_cast<std::size_t>(read));
+        if (read == 0)
+            return false;
+
+        savePcmCache(path, sound);
+        return true;
+    }
+}
@@ -6,9 +6,9 @@
 
 namespace UI
 {
-    // Construct button label with shared font. #
+    // Construct button label bound to a placeholder font. #
     Button::Button()
-        : m_label(m_font)
+        : m_label(ResourceCache::emptyFont())
     {
     }
 
@@ -22,7 +22,8 @@ namespace UI
         if (!initTiles(tilePath, hoverTilePath))
             return false;
 
-        if (!m_font.openFromFile(fontPath))
+        m_font = ResourceCache::instance().font(fontPath);
+        if (!m_font)
         {
             std::cerr << "Failed to load font: " << fontPath << " (cwd: "
                       << std::filesystem::current_path().string() << ")\n";
@@ -30,7 +31,7 @@ namespace UI
         }
 
         m_baseFontSize = fontSize;
-        m_label.setFont(m_font);
+        m_label.setFont(*m_font);
         m_label.setString(label);
         m_label.setFillColor(sf::Color::White);
         m_label.setCharacterSize(m_baseFontSize);
@@ -1,4 +1,5 @@
 #include "ui/GameRenderer.hpp"
+#include "ui/Profiler.hpp"
 #include "ui/ViewUtils.hpp"
 #include <iostream>
 #include <cmath>
@@ -13,7 +14,7 @@ namespace UI
 
     // Initialize renderer metrics and board origin. #
     GameRenderer::GameRenderer()
-        : m_spriteTile(m_texTile),
+        : m_batch(sf::PrimitiveType::Triangles),
           m_isoWidth(ISO_WIDTH),
           m_isoHeight(ISO_HEIGHT)
     {
@@ -33,27 +34,15 @@ namespace UI
         m_boardOrigin = {originX, originY - 30.f * UI::BOARD_SCALE};
     }
 
-    // Load tile texture and configure sprite scaling. #
+    // Pack tile, wall, and pawn textures into the board atlas. #
     bool GameRenderer::init()
     {
-        // 1. Load Tile Texture (tiles are renderer-owned)
-        if (!m_texTile.loadFromFile("assets/textures/tile.png"))
-        {
-            std::cerr << "Error: Could not load tile.png\n";
-            return false;
-        }
-
-        // Setup Tile Sprite
-        m_spriteTile.setTexture(m_texTile, true);
-        sf::Vector2u tSize = m_texTile.getSize();
-        m_spriteTile.setOrigin({float(tSize.x) / 2.f, float(tSize.y) / 2.f});
-        if (tSize.x > 0 && tSize.y > 0)
-        {
-            m_spriteTile.setScale({(UI::FIELD_SIZE.x * UI::BOARD_SCALE) / float(tSize.x),
-                                   (UI::FIELD_SIZE.y * UI::BOARD_SCALE) / float(tSize.y)});
-        }
-
-        return true;
+        // Order must match AtlasImage.
+        return m_atlas.build({"assets/textures/tile.png",
+                              "assets/textures/wall-upper.png",
+                              "assets/textures/wall-down.png",
+                              "assets/textures/pawn_p1.png",
+                              "assets/textures/pawn_p2.png"});
     }
 
     // Convert grid coordinates to screen position. #
@@ -64,146 +53,151 @@ namespace UI
         return {x + m_boardOrigin.x, y + m_boardOrigin.y};
     }
 
-    // Apply orientation-based transforms to a wall sprite. #
-    void GameRenderer::applyWallTransform(sf::Sprite &sprite, sf::Vector2f &pos, Game::Orientation orientation) const
+    // Append two triangles for an atlas image placed like a sprite (origin, scale, position). #
+    void GameRenderer::appendQuad(AtlasImage image, sf::Vector2f position, sf::Vector2f origin, sf::Vector2f scale, sf::Color color)
     {
-        sprite.setRotation(sf::degrees(0));
-        sprite.setScale({1.f, 1.f});
+        const sf::IntRect &rect = m_atlas.region(image);
+        const sf::Vector2f size(rect.size);
+        const sf::Vector2f texTopLeft(rect.position);
 
-        if (orientation == Game::Orientation::Horizontal)
-        {
-            pos.y += m_isoHeight * 0.1f;
-        }
-        else
+        const sf::Vector2f corners[4] = {{0.f, 0.f}, {size.x, 0.f}, {0.f, size.y}, {size.x, size.y}};
+        sf::Vertex quad[4];
+        for (int i = 0; i < 4; ++i)
         {
-            sprite.setScale({-1.f, 1.f});
+            quad[i].position = {position.x + (corners[i].x - origin.x) * scale.x,
+                                position.y + (corners[i].y - origin.y) * scale.y};
+            quad[i].texCoords = texTopLeft + corners[i];
+            quad[i].color = color;
         }
+
+        m_batch.append(quad[0]);
+        m_batch.append(quad[1]);
+        m_batch.append(quad[2]);
+        m_batch.append(quad[2]);
+        m_batch.append(quad[1]);
+        m_batch.append(quad[3]);
     }
 
-    // Draw a wall sprite part at a grid position. #
-    void GameRenderer::drawWallPart(sf::RenderWindow &window, sf::Vector2i gridPos, Game::Orientation orientation, const sf::Sprite &baseSprite, bool isPreview)
+    // Emit a wall part at a grid position; vertical walls are mirrored horizontally. #
+    void GameRenderer::appendWallPart(sf::Vector2i gridPos, Game::Orientation orientation, AtlasImage image, bool isPreview)
     {
         sf::Vector2f pos = cartesianToIsometric(gridPos.x, gridPos.y);
-        sf::Sprite s = baseSprite;
-        applyWallTransform(s, pos, orientation);
+        const sf::Vector2f texSize(m_atlas.region(image).size);
+        sf::Vector2f scale = {(UI::WALL_SIZE.x * UI::BOARD_SCALE) / texSize.x,
+                              (UI::WALL_SIZE.y * UI::BOARD_SCALE) / texSize.y};
 
-        const sf::Texture &texture = s.getTexture();
-        const sf::Vector2u texSize = texture.getSize();
-        if (texSize.x > 0 && texSize.y > 0)
-        {
-            const sf::Vector2f currentScale = s.getScale();
-            const sf::Vector2f targetScale = {(UI::WALL_SIZE.x * UI::BOARD_SCALE) / float(texSize.x),
-                                              (UI::WALL_SIZE.y * UI::BOARD_SCALE) / float(texSize.y)};
-            s.setScale({currentScale.x * targetScale.x,
-                        currentScale.y * targetScale.y});
-        }
+        if (orientation == Game::Orientation::Horizontal)
+            pos.y += m_isoHeight * 0.1f;
+        else
+            scale.x = -scale.x;
 
-        s.setPosition(pos);
-        s.setColor(isPreview ? sf::Color(255, 255, 255, 128) : sf::Color(255, 255, 255));
-        window.draw(s);
+        appendQuad(image, pos, {texSize.x / 1.09f, texSize.y / 1.29f}, scale,
+                   isPreview ? sf::Color(255, 255, 255, 128) : sf::Color(255, 255, 255));
     }
 
-    // Draw a single tile at grid coordinates. #
-    void GameRenderer::drawTile(sf::RenderWindow &window, int gridX, int gridY)
+    // Emit a single tile at grid coordinates. #
+    void GameRenderer::appendTile(int gridX, int gridY)
     {
-        sf::Vector2f pos = cartesianToIsometric(gridX, gridY);
-
-        if (gridX == m_hoveredCoords.x && gridY == m_hoveredCoords.y && !m_showWallPreview)
-            m_spriteTile.setColor(sf::Color::White);
-        else
-            m_spriteTile.setColor(sf::Color(200, 200, 200));
+        const sf::Vector2f texSize(m_atlas.region(ATLAS_TILE).size);
+        const bool hovered = gridX == m_hoveredCoords.x && gridY == m_hoveredCoords.y && !m_showWallPreview;
 
-        m_spriteTile.setPosition(pos);
-        window.draw(m_spriteTile);
+        appendQuad(ATLAS_TILE, cartesianToIsometric(gridX, gridY), texSize / 2.f,
+                   {(UI::FIELD_SIZE.x * UI::BOARD_SCALE) / texSize.x, (UI::FIELD_SIZE.y * UI::BOARD_SCALE) / texSize.y},
+                   hovered ? sf::Color::White : sf::Color(200, 200, 200));
     }
 
-    // Draw any pawn that occupies the grid cell. #
-    void GameRenderer::drawPawnAt(sf::RenderWindow &window, const std::vector<Game::Pawn> &pawns, int gridX, int gridY)
+    // Emit one indexed pawn or wall part at its cell. #
+    void GameRenderer::appendCellItem(const CellItem &item, int gridX, int gridY)
     {
-        for (const auto &pawn : pawns)
+        if (item.image == ATLAS_WALL_UPPER || item.image == ATLAS_WALL_DOWN)
         {
-            if (pawn.x() != gridX || pawn.y() != gridY)
-                continue;
-
-            sf::Vector2f pos = cartesianToIsometric(pawn.x(), pawn.y());
-
-            sf::Sprite s = pawn.sprite();
-            const sf::Texture &texture = s.getTexture();
-            const sf::Vector2u texSize = texture.getSize();
-            if (texSize.x > 0 && texSize.y > 0)
-            {
-                const sf::Vector2f targetSize = pawn.id() == 1 ? UI::PAWN_P1_SIZE
-                                                               : UI::PAWN_P2_SIZE;
-                s.setScale({(targetSize.x * UI::BOARD_SCALE) / float(texSize.x),
-                            (targetSize.y * UI::BOARD_SCALE) / float(texSize.y)});
-            }
-            s.setColor(sf::Color::White);
-            s.setPosition(pos);
-            window.draw(s);
+            appendWallPart({gridX, gridY}, item.orientation, item.image, item.isPreview);
+            return;
         }
+
+        const sf::Vector2f texSize(m_atlas.region(item.image).size);
+        const sf::Vector2f targetSize = item.image == ATLAS_PAWN_P1 ? UI::PAWN_P1_SIZE
+                                                                    : UI::PAWN_P2_SIZE;
+        appendQuad(item.image, cartesianToIsometric(gridX, gridY),
+                   {texSize.x / 2.f, texSize.y - UI::PAWN_BASELINE_OFFSET},
+                   {(targetSize.x * UI::BOARD_SCALE) / texSize.x, (targetSize.y * UI::BOARD_SCALE) / texSize.y},
+                   sf::Color::White);
     }
 
-    // Draw wall segments affecting the grid cell. #
-    void GameRenderer::drawWallsAt(sf::RenderWindow &window, const std::vector<Game::Wall> &walls, int gridX, int gridY)
+    // Bucket pawns, wall halves, and the preview by the cell they are drawn after (counting sort). #
+    void GameRenderer::rebuildCellIndex(const Game::Board &board)
     {
-        for (const auto &wall : walls)
+        struct Placed
         {
-            if (wall.x() == gridX && wall.y() == gridY)
-            {
-                drawWallPart(window, {gridX, gridY}, wall.orientation(), wall.upperSprite(), false);
-                continue;
-            }
-
-            if (wall.orientation() == Game::Orientation::Vertical)
-            {
-                if (wall.x() == gridX && wall.y() + 1 == gridY)
-                    drawWallPart(window, {gridX, gridY}, wall.orientation(), wall.downSprite(), false);
-            }
-            else
-            {
-                if (wall.x() + 1 == gridX && wall.y() == gridY)
-                    drawWallPart(window, {gridX, gridY}, wall.orientation(), wall.downSprite(), false);
-            }
-        }
+            int cell;
+            CellItem item;
+        };
+        std::vector<Placed> placed;
+        placed.reserve(board.getAllPawns().size() + board.getAllWalls().size() * 2 + 2);
 
-        if (m_showWallPreview && m_previewWallPos.x != -1)
+        auto addWall = [&placed](sf::Vector2i pos, Game::Orientation orientation, bool isPreview)
         {
-            if (m_previewWallPos.x == gridX && m_previewWallPos.y == gridY)
-            {
-                drawWallPart(window, {gridX, gridY}, m_previewWallOri, Game::Wall::previewUpperSprite(), true);
-            }
-            else if (m_previewWallOri == Game::Orientation::Vertical)
-            {
-                if (m_previewWallPos.x == gridX && m_previewWallPos.y + 1 == gridY)
-                    drawWallPart(window, {gridX, gridY}, m_previewWallOri, Game::Wall::previewDownSprite(), true);
-            }
-            else
-            {
-                if (m_previewWallPos.x + 1 == gridX && m_previewWallPos.y == gridY)
-                    drawWallPart(window, {gridX, gridY}, m_previewWallOri, Game::Wall::previewDownSprite(), true);
-            }
+            // The lower half sits one cell further along the wall's length.
+            const sf::Vector2i second = orientation == Game::Orientation::Vertical ? sf::Vector2i{pos.x, pos.y + 1}
+                                                                                   : sf::Vector2i{pos.x + 1, pos.y};
+            placed.push_back({pos.y * Game::Board::SIZE + pos.x, {ATLAS_WALL_UPPER, orientation, isPreview}});
+            if (second.x < Game::Board::SIZE && second.y < Game::Board::SIZE)
+                placed.push_back({second.y * Game::Board::SIZE + second.x, {ATLAS_WALL_DOWN, orientation, isPreview}});
+        };
+
+        // Within a cell: pawns, then walls in placement order, then the preview (same as the old per-cell scans).
+        for (const auto &pawn : board.getAllPawns())
+        {
+            if (board.isValid(pawn.x(), pawn.y()))
+                placed.push_back({pawn.y() * Game::Board::SIZE + pawn.x(),
+                                  {pawn.id() == 1 ? ATLAS_PAWN_P1 : ATLAS_PAWN_P2, Game::Orientation::Horizontal, false}});
         }
+        for (const auto &wall : board.getAllWalls())
+            addWall({wall.x(), wall.y()}, wall.orientation(), false);
+        if (m_showWallPreview && board.isValid(m_previewWallPos.x, m_previewWallPos.y))
+            addWall(m_previewWallPos, m_previewWallOri, true);
+
+        m_cellStart.fill(0);
+        for (const Placed &entry : placed)
+            ++m_cellStart[entry.cell + 1];
+        for (int cell = 0; cell < CELL_COUNT; ++cell)
+            m_cellStart[cell + 1] += m_cellStart[cell];
+
+        m_cellItems.resize(placed.size());
+        std::array<int, CELL_COUNT> next{};
+        for (const Placed &entry : placed)
+            m_cellItems[m_cellStart[entry.cell] + next[entry.cell]++] = entry.item;
+
+        m_indexedBoard = &board;
+        m_indexedRevision = board.revision();
+        m_cellIndexDirty = false;
     }
 
-    // Render the board, tiles, pawns, and walls. #
+    // Render the background, then tiles, pawns, and walls as one back-to-front batch. #
     void GameRenderer::render(sf::RenderWindow &window, const Game::Board &board)
     {
+        ProfileScope zone("GameRenderer::render");
         window.setView(m_view);
 
         board.drawBackground(window);
 
-        const auto &pawns = board.getAllPawns();
-        const auto &walls = board.getAllWalls();
+        if (m_cellIndexDirty || m_indexedBoard != &board || m_indexedRevision != board.revision())
+            rebuildCellIndex(board);
 
+        // Row-major emission keeps the painter's order the per-sprite draws used.
+        m_batch.clear();
         for (int row = 0; row < Game::Board::SIZE; ++row)
         {
             for (int x = 0; x < Game::Board::SIZE; ++x)
             {
-                drawTile(window, x, row);
-                drawPawnAt(window, pawns, x, row);
-                drawWallsAt(window, walls, x, row);
+                appendTile(x, row);
+                const int cell = row * Game::Board::SIZE + x;
+                for (int i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i)
+                    appendCellItem(m_cellItems[i], x, row);
             }
         }
+
+        window.draw(m_batch, &m_atlas.texture());
     }
 
     // Recompute view for the new window size. #
@@ -249,8 +243,12 @@ namespace UI
     // Enable or update wall preview display. #
     void GameRenderer::setWallPreview(bool active, sf::Vector2i gridPos, Game::Orientation orientation)
     {
+        if (active == m_showWallPreview && gridPos == m_previewWallPos && orientation == m_previewWallOri)
+            return;
+
         m_showWallPreview = active;
         m_previewWallPos = gridPos;
         m_previewWallOri = orientation;
+        m_cellIndexDirty = true;
     }
 }
@@ -1,4 +1,5 @@
 #include "ui/Hud.hpp"
+#include "ui/Profiler.hpp"
 #include "ui/ViewUtils.hpp"
 #include <algorithm>
 #include <cmath>
@@ -14,46 +15,51 @@ namespace UI
     static constexpr float WALLS_TEXT_RIGHT_PADDING = 39.f;
     static constexpr float WALLS_TEXT_FONT_SIZE = 40.f;
 
-    // Construct HUD sprites and texts with shared textures/fonts. #
+    // Construct HUD sprites and texts bound to placeholders until init. #
     Hud::Hud()
-        : m_player1IndicatorSprite(m_player1IndicatorTexture),
-          m_player2IndicatorSprite(m_player2IndicatorTexture),
-          m_player1WallsText(m_font),
-          m_player2WallsText(m_font)
+        : m_player1IndicatorSprite(ResourceCache::emptyTexture()),
+          m_player2IndicatorSprite(ResourceCache::emptyTexture()),
+          m_player1WallsText(ResourceCache::emptyFont()),
+          m_player2WallsText(ResourceCache::emptyFont())
     {
     }
 
     // Load indicator textures and font assets. #
     bool Hud::init()
     {
-        if (!m_player1IndicatorTexture.loadFromFile("assets/textures/player1-indicator.png"))
+        ResourceCache &cache = ResourceCache::instance();
+        m_player1IndicatorTexture = cache.texture("assets/textures/player1-indicator.png");
+        if (!m_player1IndicatorTexture)
         {
             std::cerr << "Failed to load player1-indicator.png" << std::endl;
             return false;
         }
 
-        if (!m_player2IndicatorTexture.loadFromFile("assets/textures/player2-indicator.png"))
+        m_player2IndicatorTexture = cache.texture("assets/textures/player2-indicator.png");
+        if (!m_player2IndicatorTexture)
         {
             std::cerr << "Failed to load player2-indicator.png" << std::endl;
             return false;
         }
 
-        m_player1IndicatorSprite.setTexture(m_player1IndicatorTexture, true);
-        m_player2IndicatorSprite.setTexture(m_player2IndicatorTexture, true);
+        m_player1IndicatorSprite.setTexture(*m_player1IndicatorTexture, true);
+        m_player2IndicatorSprite.setTexture(*m_player2IndicatorTexture, true);
         m_player2IndicatorSprite.setOrigin({0.f, 0.f});
 
         m_hasIndicators = true;
 
-        if (!m_font.openFromFile("assets/fonts/pixelon.ttf"))
+        m_font = cache.font("assets/fonts/pixelon.ttf");
+        if (!m_font)
         {
             std::cerr << "Failed to load font: assets/fonts/pixelon.ttf (cwd: "
                       << std::filesystem::current_path().string() << ")\n";
             return false;
         }
 
-        m_player1WallsText.setFillColor(sf::Color::White);
-        m_player2WallsText.setFillColor(sf::Color::White);
+        m_player1WallsText.setFont(*m_font);
+        m_player2WallsText.setFont(*m_font);
         m_hasFont = true;
+        applyTurnColors();
 
         return true;
     }
@@ -64,96 +70,112 @@ namespace UI
         m_currentPlayerId = currentPlayerId;
         m_player1WallsText.setString("Walls: " + std::to_string(p1WallsRemaining) + "/" + std::to_string(maxWallsPerPlayer));
         m_player2WallsText.setString("Walls: " + std::to_string(p2WallsRemaining) + "/" + std::to_string(maxWallsPerPlayer));
+        applyTurnColors();
+        if (m_hasLayout)
+            alignTexts();
     }
 
-    // Render indicators and wall counts in UI view. #
+    // Lay out indicators and counters in the letterboxed UI view for a window size. #
+    void Hud::handleResize(sf::Vector2u windowSize)
+    {
+        m_layoutWindowSize = windowSize;
+        m_hasLayout = true;
+        m_view = UI::makeLetterboxView(windowSize);
+        if (!m_hasIndicators)
+            return;
+
+        const sf::Vector2f viewSize = m_view.getSize();
+        const sf::Vector2f viewCenter = m_view.getCenter();
+        const sf::Vector2f topLeft = {viewCenter.x - viewSize.x / 2.f,
+                                      viewCenter.y - viewSize.y / 2.f};
+
+        const float scale = std::max(viewSize.x / UI_CANVAS_SIZE.x,
+                                     viewSize.y / UI_CANVAS_SIZE.y);
+        const sf::Vector2f scaledIndicatorSize = {INDICATOR_DESIGN_SIZE.x * scale,
+                                                  INDICATOR_DESIGN_SIZE.y * scale};
+        const sf::Vector2f margin = {INDICATOR_MARGIN * scale,
+                                     INDICATOR_MARGIN * scale};
+
+        const sf::Vector2u p1TexSize = m_player1IndicatorTexture->getSize();
+        const sf::Vector2u p2TexSize = m_player2IndicatorTexture->getSize();
+
+        m_player1IndicatorSprite.setScale({scaledIndicatorSize.x / float(p1TexSize.x),
+                                           scaledIndicatorSize.y / float(p1TexSize.y)});
+        m_player2IndicatorSprite.setScale({scaledIndicatorSize.x / float(p2TexSize.x),
+                                           scaledIndicatorSize.y / float(p2TexSize.y)});
+
+        m_player1IndicatorSprite.setPosition({topLeft.x + margin.x,
+                                              topLeft.y + margin.y});
+        m_player2IndicatorSprite.setPosition({topLeft.x + viewSize.x - margin.x - scaledIndicatorSize.x,
+                                              topLeft.y + margin.y});
+
+        if (!m_hasFont)
+            return;
+
+        // Changing the character size re-rasterizes glyphs, so it only happens here.
+        const unsigned int fontSize = std::max(1u, static_cast<unsigned int>(
+                                                       std::round(WALLS_TEXT_FONT_SIZE * scale)));
+        m_player1WallsText.setCharacterSize(fontSize);
+        m_player2WallsText.setCharacterSize(fontSize);
+
+        const float textRightPadding = WALLS_TEXT_RIGHT_PADDING * scale;
+        const float textCenterY = topLeft.y + margin.y + scaledIndicatorSize.y / 2.f;
+        const sf::Vector2f p1TopLeft = m_player1IndicatorSprite.getPosition();
+        const sf::Vector2f p2TopLeft = m_player2IndicatorSprite.getPosition();
+        m_player1TextAnchor = {p1TopLeft.x + scaledIndicatorSize.x - textRightPadding, textCenterY};
+        m_player2TextAnchor = {p2TopLeft.x + textRightPadding, textCenterY};
+        alignTexts();
+    }
+
+    // Tint the active player's indicator and counter. #
+    void Hud::applyTurnColors()
+    {
+        const bool isPlayer1Turn = m_currentPlayerId == 1;
+        const sf::Color activeTint = sf::Color::White;
+        const sf::Color inactiveTint(90, 90, 90, 255);
+
+        m_player1IndicatorSprite.setColor(isPlayer1Turn ? activeTint : inactiveTint);
+        m_player2IndicatorSprite.setColor(isPlayer1Turn ? inactiveTint : activeTint);
+        m_player1WallsText.setFillColor(isPlayer1Turn ? activeTint : inactiveTint);
+        m_player2WallsText.setFillColor(isPlayer1Turn ? inactiveTint : activeTint);
+    }
+
+    // Right-align player 1's counter and left-align player 2's on their anchors. #
+    void Hud::alignTexts()
+    {
+        if (!m_hasFont)
+            return;
+
+        const sf::FloatRect p1Bounds = m_player1WallsText.getLocalBounds();
+        m_player1WallsText.setOrigin({p1Bounds.position.x + p1Bounds.size.x,
+                                      p1Bounds.position.y + p1Bounds.size.y / 2.f});
+        m_player1WallsText.setPosition(m_player1TextAnchor);
+
+        const sf::FloatRect p2Bounds = m_player2WallsText.getLocalBounds();
+        m_player2WallsText.setOrigin({p2Bounds.position.x,
+                                      p2Bounds.position.y + p2Bounds.size.y / 2.f});
+        m_player2WallsText.setPosition(m_player2TextAnchor);
+    }
+
+    // Draw indicators and wall counts with the cached UI view. #
     void Hud::render(sf::RenderWindow &window)
     {
-        // Save current view (Isometric)
-        sf::View oldView = window.getView();
+        ProfileScope zone("Hud::render");
+        if (!m_hasLayout || window.getSize() != m_layoutWindowSize)
+            handleResize(window.getSize());
+        if (!m_hasIndicators)
+            return;
 
-        // Switch to 2D Screen view for UI
-        sf::View uiView = UI::makeLetterboxView(window.getSize());
-        window.setView(uiView);
+        // Save current view (Isometric)
+        const sf::View oldView = window.getView();
+        window.setView(m_view);
 
-        if (m_hasIndicators)
+        window.draw(m_player1IndicatorSprite);
+        window.draw(m_player2IndicatorSprite);
+        if (m_hasFont)
         {
-            const sf::Vector2f viewSize = uiView.getSize();
-            const sf::Vector2f viewCenter = uiView.getCenter();
-            const sf::Vector2f topLeft = {viewCenter.x - viewSize.x / 2.f,
-                                          viewCenter.y - viewSize.y / 2.f};
-
-            const float scale = std::max(viewSize.x / UI_CANVAS_SIZE.x,
-                                         viewSize.y / UI_CANVAS_SIZE.y);
-            const sf::Vector2f scaledIndicatorSize = {INDICATOR_DESIGN_SIZE.x * scale,
-                                                      INDICATOR_DESIGN_SIZE.y * scale};
-            const sf::Vector2f margin = {INDICATOR_MARGIN * scale,
-                                         INDICATOR_MARGIN * scale};
-
-            const sf::Vector2u p1TexSize = m_player1IndicatorTexture.getSize();
-            const sf::Vector2u p2TexSize = m_player2IndicatorTexture.getSize();
-
-            m_player1IndicatorSprite.setScale({scaledIndicatorSize.x / float(p1TexSize.x),
-                                               scaledIndicatorSize.y / float(p1TexSize.y)});
-            m_player2IndicatorSprite.setScale({scaledIndicatorSize.x / float(p2TexSize.x),
-                                               scaledIndicatorSize.y / float(p2TexSize.y)});
-
-            m_player1IndicatorSprite.setPosition({topLeft.x + margin.x,
-                                                  topLeft.y + margin.y});
-            m_player2IndicatorSprite.setPosition({topLeft.x + viewSize.x - margin.x - scaledIndicatorSize.x,
-                                                  topLeft.y + margin.y});
-
-            const bool isPlayer1Turn = m_currentPlayerId == 1;
-            const sf::Color activeTint = sf::Color::White;
-            const sf::Color inactiveTint(90, 90, 90, 255);
-
-            m_player1IndicatorSprite.setColor(isPlayer1Turn ? activeTint : inactiveTint);
-            m_player2IndicatorSprite.setColor(isPlayer1Turn ? inactiveTint : activeTint);
-
-            window.draw(m_player1IndicatorSprite);
-            window.draw(m_player2IndicatorSprite);
-
-            if (m_hasFont)
-            {
-                const unsigned int fontSize = std::max(1u, static_cast<unsigned int>(
-                                                               std::round(WALLS_TEXT_FONT_SIZE * scale)));
-
-                m_player1WallsText.setCharacterSize(fontSize);
-                m_player2WallsText.setCharacterSize(fontSize);
-                m_player1WallsText.setFillColor(isPlayer1Turn ? activeTint : inactiveTint);
-                m_player2WallsText.setFillColor(isPlayer1Turn ? inactiveTint : activeTint);
-
-                const float textRightPadding = WALLS_TEXT_RIGHT_PADDING * scale;
-                const float textCenterY = topLeft.y + margin.y + scaledIndicatorSize.y / 2.f;
-
-                const sf::Vector2f p1TopLeft = m_player1IndicatorSprite.getPosition();
-                const sf::Vector2f p2TopLeft = m_player2IndicatorSprite.getPosition();
-
-                auto positionRightAlignedText = [](sf::Text &text, float x, float y)
-                {
-                    const sf::FloatRect bounds = text.getLocalBounds();
-                    text.setOrigin({bounds.position.x + bounds.size.x,
-                                    bounds.position.y + bounds.size.y / 2.f});
-                    text.setPosition({x, y});
-                };
-                auto positionLeftAlignedText = [](sf::Text &text, float x, float y)
-                {
-                    const sf::FloatRect bounds = text.getLocalBounds();
-                    text.setOrigin({bounds.position.x,
-                                    bounds.position.y + bounds.size.y / 2.f});
-                    text.setPosition({x, y});
-                };
-
-                positionRightAlignedText(m_player1WallsText,
-                                         p1TopLeft.x + scaledIndicatorSize.x - textRightPadding,
-                                         textCenterY);
-                positionLeftAlignedText(m_player2WallsText,
-                                        p2TopLeft.x + textRightPadding,
-                                        textCenterY);
-
-                window.draw(m_player1WallsText);
-                window.draw(m_player2WallsText);
-            }
+            window.draw(m_player1WallsText);
+            window.draw(m_player2WallsText);
         }
 
         // Restore World view
@@ -1,5 +1,6 @@
 #include "ui/InGameBottomBar.hpp"
 #include "audio/SfxManager.hpp"
+#include "ui/Profiler.hpp"
 #include "ui/UiConstants.hpp"
 #include "ui/ViewUtils.hpp"
 #include <algorithm>
@@ -19,56 +20,61 @@ namespace UI
         const sf::Color WALL_MODE_ACTIVE_COLOR(200, 200, 200, 180);
     }
 
-    // Construct sprites and labels bound to textures/fonts. #
+    // Construct sprites and labels bound to placeholders until init. #
     InGameBottomBar::InGameBottomBar()
-        : m_hamburgerSprite(m_hamburgerTexture),
-          m_wIconSprite(m_wIconTexture),
-          m_rIconSprite(m_rIconTexture),
-          m_wLabel(m_font),
-          m_rLabel(m_font)
+        : m_hamburgerSprite(ResourceCache::emptyTexture()),
+          m_wIconSprite(ResourceCache::emptyTexture()),
+          m_rIconSprite(ResourceCache::emptyTexture()),
+          m_wLabel(ResourceCache::emptyFont()),
+          m_rLabel(ResourceCache::emptyFont())
     {
     }
 
     // Load icons, font, and initialize label text. #
     bool InGameBottomBar::init()
     {
-        if (!m_hamburgerTexture.loadFromFile(HAMBURGER_ICON_PATH))
+        ResourceCache &cache = ResourceCache::instance();
+        m_hamburgerTexture = cache.texture(HAMBURGER_ICON_PATH);
+        if (!m_hamburgerTexture)
         {
             std::cerr << "Failed to load hamburger icon: " << HAMBURGER_ICON_PATH << "\n";
             return false;
         }
 
-        m_hamburgerSprite.setTexture(m_hamburgerTexture, true);
-        const sf::Vector2u texSize = m_hamburgerTexture.getSize();
+        m_hamburgerSprite.setTexture(*m_hamburgerTexture, true);
+        const sf::Vector2u texSize = m_hamburgerTexture->getSize();
         m_hamburgerSprite.setOrigin({static_cast<float>(texSize.x) / 2.f,
                                      static_cast<float>(texSize.y) / 2.f});
 
-        if (!m_wIconTexture.loadFromFile(W_ICON_PATH))
+        m_wIconTexture = cache.texture(W_ICON_PATH);
+        if (!m_wIconTexture)
         {
             std::cerr << "Failed to load W icon: " << W_ICON_PATH << "\n";
             return false;
         }
 
-        if (!m_rIconTexture.loadFromFile(R_ICON_PATH))
+        m_rIconTexture = cache.texture(R_ICON_PATH);
+        if (!m_rIconTexture)
         {
             std::cerr << "Failed to load R icon: " << R_ICON_PATH << "\n";
             return false;
         }
 
-        m_wIconSprite.setTexture(m_wIconTexture, true);
-        m_rIconSprite.setTexture(m_rIconTexture, true);
-        const sf::Vector2u wTexSize = m_wIconTexture.getSize();
-        const sf::Vector2u rTexSize = m_rIconTexture.getSize();
+        m_wIconSprite.setTexture(*m_wIconTexture, true);
+        m_rIconSprite.setTexture(*m_rIconTexture, true);
+        const sf::Vector2u wTexSize = m_wIconTexture->getSize();
+        const sf::Vector2u rTexSize = m_rIconTexture->getSize();
         m_wIconSprite.setOrigin({static_cast<float>(wTexSize.x) / 2.f,
                                  static_cast<float>(wTexSize.y) / 2.f});
         m_rIconSprite.setOrigin({static_cast<float>(rTexSize.x) / 2.f,
                                  static_cast<float>(rTexSize.y) / 2.f});
 
-        if (m_font.openFromFile("assets/fonts/pixelon.ttf"))
+        m_font = cache.font("assets/fonts/pixelon.ttf");
+        if (m_font)
         {
             m_hasFont = true;
-            m_wLabel.setFont(m_font);
-            m_rLabel.setFont(m_font);
+            m_wLabel.setFont(*m_font);
+            m_rLabel.setFont(*m_font);
             m_wLabel.setString(W_LABEL_TEXT);
             m_rLabel.setString(R_LABEL_TEXT);
             m_wLabel.setFillColor(sf::Color::White);
@@ -111,6 +117,15 @@ namespace UI
         if (!m_wallModeActive)
             m_rHovered = false;
         updateWallIndicatorColors();
+        // The rotate control appears or disappears, so the control row is laid out again.
+        if (m_hasLayout)
+            layoutControlsIcons();
+    }
+
+    // Recompute layout for a new window size. #
+    void InGameBottomBar::handleResize(sf::Vector2u windowSize)
+    {
+        updateLayout(windowSize);
     }
 
     // Handle hover and click interactions inside the bar. #
@@ -118,7 +133,7 @@ namespace UI
     {
         if (const auto *mouseMove = event.getIf<sf::Event::MouseMoved>())
         {
-            updateLayout(window);
+            ensureLayout(window.getSize());
             const sf::Vector2f worldPos = window.mapPixelToCoords(mouseMove->position, m_view);
             updateHoverState(worldPos);
             return m_barBounds.contains(worldPos);
@@ -129,7 +144,7 @@ namespace UI
             if (mouseBtn->button != sf::Mouse::Button::Left)
                 return false;
 
-            updateLayout(window);
+            ensureLayout(window.getSize());
             const sf::Vector2f worldPos = window.mapPixelToCoords(mouseBtn->position, m_view);
             if (m_wControlBounds.contains(worldPos))
             {
@@ -163,7 +178,8 @@ namespace UI
     // Draw bar, icons, labels, and menu button. #
     void InGameBottomBar::render(sf::RenderWindow &window)
     {
-        updateLayout(window);
+        ProfileScope zone("InGameBottomBar::render");
+        ensureLayout(window.getSize());
 
         sf::View oldView = window.getView();
         window.setView(m_view);
@@ -192,10 +208,19 @@ namespace UI
         applyHoverColor();
     }
 
+    // Lay out on first use and whenever the window size differs from the cached layout. #
+    void InGameBottomBar::ensureLayout(sf::Vector2u windowSize)
+    {
+        if (!m_hasLayout || windowSize != m_layoutWindowSize)
+            updateLayout(windowSize);
+    }
+
     // Recalculate geometry based on current view size. #
-    void InGameBottomBar::updateLayout(const sf::RenderWindow &window)
+    void InGameBottomBar::updateLayout(sf::Vector2u windowSize)
     {
-        m_view = UI::makeLetterboxView(window.getSize());
+        m_layoutWindowSize = windowSize;
+        m_hasLayout = true;
+        m_view = UI::makeLetterboxView(windowSize);
         m_viewSize = m_view.getSize();
         const sf::Vector2f viewCenter = m_view.getCenter();
         m_viewTopLeft = {viewCenter.x - m_viewSize.x / 2.f,
@@ -213,7 +238,7 @@ namespace UI
         m_bar.setPosition({m_viewTopLeft.x, m_viewTopLeft.y + m_viewSize.y - m_barHeight});
         m_bar.setFillColor(sf::Color(0, 0, 0, 204));
 
-        const sf::Vector2u texSize = m_hamburgerTexture.getSize();
+        const sf::Vector2u texSize = m_hamburgerSprite.getTexture().getSize();
         if (texSize.x > 0 && texSize.y > 0)
         {
             m_hamburgerSprite.setScale({iconSize.x / static_cast<float>(texSize.x),
@@ -355,8 +380,8 @@ namespace UI
 
         const float centerY = m_bar.getPosition().y + m_barHeight / 2.f;
 
-        const sf::Vector2u wTexSize = m_wIconTexture.getSize();
-        const sf::Vector2u rTexSize = m_rIconTexture.getSize();
+        const sf::Vector2u wTexSize = m_wIconSprite.getTexture().getSize();
+        const sf::Vector2u rTexSize = m_rIconSprite.getTexture().getSize();
         if (wTexSize.x > 0 && wTexSize.y > 0)
         {
             m_wIconSprite.setScale({iconWidth / static_cast<float>(wTexSize.x),
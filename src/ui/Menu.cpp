@@ -7,7 +7,7 @@ namespace UI
 {
     // Construct menu sprites and backdrop geometry. #
     Menu::Menu()
-        : m_backgroundSprite(m_backgroundTexture),
+        : m_backgroundSprite(ResourceCache::emptyTexture()),
           m_screenBackdrop(sf::PrimitiveType::TriangleStrip, 4)
     {
     }
@@ -15,11 +15,12 @@ namespace UI
     // Load background texture and setup sprite. #
     bool Menu::initBackground(const std::string &path)
     {
-        if (!m_backgroundTexture.loadFromFile(path))
+        m_backgroundTexture = ResourceCache::instance().texture(path);
+        if (!m_backgroundTexture)
             return false;
 
-        m_backgroundSprite.setTexture(m_backgroundTexture, true);
-        const sf::Vector2u size = m_backgroundTexture.getSize();
+        m_backgroundSprite.setTexture(*m_backgroundTexture, true);
+        const sf::Vector2u size = m_backgroundTexture->getSize();
         m_backgroundSprite.setOrigin({static_cast<float>(size.x) / 2.f,
                                       static_cast<float>(size.y) / 2.f});
         m_hasBackground = true;
@@ -121,7 +122,7 @@ namespace UI
 
         if (m_hasBackground)
         {
-            const sf::Vector2u texSize = m_backgroundTexture.getSize();
+            const sf::Vector2u texSize = m_backgroundTexture->getSize();
             if (texSize.x > 0 && texSize.y > 0)
             {
                 const float scaleX = viewSize.x / static_cast<float>(texSize.x);
@@ -95,7 +95,7 @@ namespace UI
 
         if (m_hasBackground)
         {
-            const sf::Vector2u texSize = m_backgroundTexture.getSize();
+            const sf::Vector2u texSize = m_backgroundTexture->getSize();
             if (texSize.x > 0 && texSize.y > 0)
             {
                 const float scaleX = viewSize.x / static_cast<float>(texSize.x);
@@ -0,0 +1,251 @@
+#include "ui/Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace UI
+{
+    namespace
+    {
+        // Read a percentile from sorted values. #
+        float percentile(const std::vector<float> &sorted, float fraction)
+        {
+            const std::size_t index = static_cast<std::size_t>(fraction * static_cast<float>(sorted.size() - 1) + 0.5f);
+            return sorted[std::min(index, sorted.size() - 1)];
+        }
+
+        // Escape a name for a JSON string literal. #
+        std::string jsonEscape(const char *text)
+        {
+            std::string escaped;
+            for (const char *c = text; *c != '\0'; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                    escaped += '\\';
+                escaped += *c;
+            }
+            return escaped;
+        }
+
+        // Monotonic clock reading in nanoseconds. #
+        std::uint64_t steadyNs()
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  std::chrono::steady_clock::now().time_since_epoch())
+                                                  .count());
+        }
+    }
+
+    // Access the singleton instance shared by the loop and instrumented components. #
+    Profiler &Profiler::instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    // Anchor timestamps at creation so traces start near zero. #
+    Profiler::Profiler()
+        : m_epochNs(steadyNs())
+    {
+    }
+
+    // Start or stop recording. #
+    void Profiler::setEnabled(bool enabled)
+    {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    // Check whether zones are recorded. #
+    bool Profiler::isEnabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    // Open a loop iteration; zones recorded until endFrame() belong to it. #
+    void Profiler::beginFrame(const char *screen)
+    {
+        m_frameOpen = isEnabled();
+        if (!m_frameOpen)
+            return;
+        m_frameScreen.store(screen, std::memory_order_relaxed);
+        m_frameIndex.fetch_add(1, std::memory_order_relaxed);
+        m_frameStartNs = nowNs();
+        ++depth();
+    }
+
+    // Record the whole iteration and, if it reached the screen, its frame time. #
+    void Profiler::endFrame(bool presented)
+    {
+        if (!m_frameOpen)
+            return;
+        m_frameOpen = false;
+        --depth();
+
+        const std::uint64_t endNs = nowNs();
+        record("frame", m_frameStartNs, endNs, 0);
+        if (!presented)
+            return;
+
+        const std::uint64_t index = m_frameHead.fetch_add(1, std::memory_order_relaxed);
+        const std::uint64_t micros = std::min<std::uint64_t>((endNs - m_frameStartNs) / 1000, UINT32_MAX);
+        m_frameUs[index % FRAME_HISTORY].store(static_cast<std::uint32_t>(micros), std::memory_order_relaxed);
+    }
+
+    // Claim a slot with one atomic increment and publish it through its sequence number. #
+    void Profiler::record(const char *zone, std::uint64_t startNs, std::uint64_t endNs, std::uint16_t depth)
+    {
+        const std::uint64_t index = m_head.fetch_add(1, std::memory_order_relaxed);
+        Slot &slot = m_slots[index % SAMPLE_CAPACITY];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.sample.zone = zone;
+        slot.sample.screen = m_frameScreen.load(std::memory_order_relaxed);
+        slot.sample.startNs = startNs;
+        slot.sample.durationNs = endNs - startNs;
+        slot.sample.frame = m_frameIndex.load(std::memory_order_relaxed);
+        slot.sample.depth = depth;
+
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+    }
+
+    // Copy the published samples; slots overwritten during the copy are skipped. #
+    std::vector<ProfileSample> Profiler::snapshot() const
+    {
+        const std::uint64_t head = m_head.load(std::memory_order_acquire);
+        const std::uint64_t first = head > SAMPLE_CAPACITY ? head - SAMPLE_CAPACITY : 0;
+
+        std::vector<ProfileSample> samples;
+        samples.reserve(static_cast<std::size_t>(head - first));
+        for (std::uint64_t index = first; index < head; ++index)
+        {
+            const Slot &slot = m_slots[index % SAMPLE_CAPACITY];
+            const std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before != 2 * index + 2)
+                continue;
+            const ProfileSample sample = slot.sample;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == before)
+                samples.push_back(sample);
+        }
+        return samples;
+    }
+
+    // Presented frame times in milliseconds, oldest first. #
+    std::vector<float> Profiler::frameTimes() const
+    {
+        const std::uint64_t head = m_frameHead.load(std::memory_order_acquire);
+        const std::uint64_t first = head > FRAME_HISTORY ? head - FRAME_HISTORY : 0;
+
+        std::vector<float> times;
+        times.reserve(static_cast<std::size_t>(head - first));
+        for (std::uint64_t index = first; index < head; ++index)
+            times.push_back(static_cast<float>(m_frameUs[index % FRAME_HISTORY].load(std::memory_order_relaxed)) / 1000.f);
+        return times;
+    }
+
+    // Average and percentiles of the frame history. #
+    FrameStats Profiler::frameStats() const
+    {
+        std::vector<float> times = frameTimes();
+        FrameStats stats;
+        stats.count = times.size();
+        if (times.empty())
+            return stats;
+
+        std::sort(times.begin(), times.end());
+        float total = 0.f;
+        for (float time : times)
+            total += time;
+        stats.average = total / static_cast<float>(times.size());
+        stats.p50 = percentile(times, 0.50f);
+        stats.p95 = percentile(times, 0.95f);
+        stats.p99 = percentile(times, 0.99f);
+        stats.max = times.back();
+        return stats;
+    }
+
+    // Store the rate of the latest search iteration. #
+    void Profiler::setSearchRate(std::int64_t nodes, int elapsedMs)
+    {
+        const double rate = elapsedMs > 0 ? static_cast<double>(nodes) * 1000.0 / elapsedMs : 0.0;
+        m_searchRate.store(rate, std::memory_order_relaxed);
+    }
+
+    // Last reported nodes per second. #
+    double Profiler::searchRate() const
+    {
+        return m_searchRate.load(std::memory_order_relaxed);
+    }
+
+    // Write frame,screen,zone,depth,start_us,duration_us rows. #
+    bool Profiler::exportCsv(const std::string &path) const
+    {
+        std::ofstream out(path);
+        if (!out)
+            return false;
+
+        out << "frame,screen,zone,depth,start_us,duration_us\n";
+        for (const ProfileSample &sample : snapshot())
+        {
+            out << sample.frame << ',' << sample.screen << ',' << sample.zone << ',' << sample.depth << ','
+                << sample.startNs / 1000.0 << ',' << sample.durationNs / 1000.0 << '\n';
+        }
+        return static_cast<bool>(out);
+    }
+
+    // Write complete ("X") trace events, one per sample, grouped by screen. #
+    bool Profiler::exportChromeTrace(const std::string &path) const
+    {
+        std::ofstream out(path);
+        if (!out)
+            return false;
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        for (const ProfileSample &sample : snapshot())
+        {
+            out << (first ? "\n" : ",\n") << "{\"name\":\"" << jsonEscape(sample.zone) << "\",\"cat\":\""
+                << jsonEscape(sample.screen) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << sample.startNs / 1000.0
+                << ",\"dur\":" << sample.durationNs / 1000.0 << ",\"args\":{\"frame\":" << sample.frame << "}}";
+            first = false;
+        }
+        out << "\n]}\n";
+        return static_cast<bool>(out);
+    }
+
+    // Nanoseconds since the profiler was created. #
+    std::uint64_t Profiler::nowNs() const
+    {
+        return steadyNs() - m_epochNs;
+    }
+
+    // Open zones on the calling thread. #
+    int &Profiler::depth()
+    {
+        thread_local int open = 0;
+        return open;
+    }
+
+    // Start timing when profiling is on; otherwise do nothing. #
+    ProfileScope::ProfileScope(const char *zone)
+        : m_zone(zone)
+    {
+        Profiler &profiler = Profiler::instance();
+        m_active = profiler.isEnabled();
+        if (!m_active)
+            return;
+        ++Profiler::depth();
+        m_startNs = profiler.nowNs();
+    }
+
+    // Record the zone on scope exit. #
+    ProfileScope::~ProfileScope()
+    {
+        if (!m_active)
+            return;
+        Profiler &profiler = Profiler::instance();
+        const int depth = --Profiler::depth();
+        profiler.record(m_zone, m_startNs, profiler.nowNs(), static_cast<std::uint16_t>(std::max(0, depth)));
+    }
+}
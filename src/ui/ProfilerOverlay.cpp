@@ -0,0 +1,171 @@
+#include "ui/ProfilerOverlay.hpp"
+#include "ui/Profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace UI
+{
+    static const sf::Vector2f PANEL_ORIGIN = {8.f, 8.f};
+    static constexpr std::uint32_t ZONE_WINDOW_FRAMES = 120; // Loop iterations averaged per zone #
+    static constexpr std::size_t MAX_ZONE_LINES = 8;
+    static constexpr float FRAME_BUDGET_MS = 1000.f / 60.f;
+
+    // Construct the overlay bound to the placeholder font until init. #
+    ProfilerOverlay::ProfilerOverlay()
+        : m_text(ResourceCache::emptyFont()),
+          m_histogram(sf::PrimitiveType::Triangles)
+    {
+        m_panel.setFillColor(sf::Color(0, 0, 0, 180));
+        m_panel.setPosition(PANEL_ORIGIN);
+    }
+
+    // Load the overlay font. #
+    bool ProfilerOverlay::init()
+    {
+        m_font = ResourceCache::instance().font("assets/fonts/pixelon.ttf");
+        if (!m_font)
+        {
+            std::cerr << "Failed to load font for the profiler overlay\n";
+            return false;
+        }
+        m_text.setFont(*m_font);
+        m_text.setCharacterSize(FONT_SIZE);
+        m_text.setFillColor(sf::Color::White);
+        m_text.setPosition({PANEL_ORIGIN.x + PANEL_PADDING, PANEL_ORIGIN.y + PANEL_PADDING});
+        m_hasFont = true;
+        return true;
+    }
+
+    // Show or hide the overlay and switch recording with it. #
+    void ProfilerOverlay::setVisible(bool visible)
+    {
+        m_visible = visible;
+        Profiler::instance().setEnabled(visible);
+        if (visible)
+        {
+            refresh();
+            m_refreshClock.restart();
+        }
+    }
+
+    // Check visibility. #
+    bool ProfilerOverlay::isVisible() const
+    {
+        return m_visible;
+    }
+
+    // Time left before the next rebuild, so an idle loop can wake for it. #
+    float ProfilerOverlay::refreshDelay() const
+    {
+        return std::max(0.f, REFRESH_SECONDS - m_refreshClock.getElapsedTime().asSeconds());
+    }
+
+    // Summarize frames and zones into the text block and histogram bars. #
+    void ProfilerOverlay::refresh()
+    {
+        const Profiler &profiler = Profiler::instance();
+        const FrameStats stats = profiler.frameStats();
+        const std::vector<ProfileSample> samples = profiler.snapshot();
+
+        char line[160];
+        std::string text;
+        std::snprintf(line, sizeof(line), "Frame avg %.2f ms  p50 %.2f  p95 %.2f  p99 %.2f  max %.2f  (%zu)\n",
+                      stats.average, stats.p50, stats.p95, stats.p99, stats.max, stats.count);
+        text += line;
+        std::snprintf(line, sizeof(line), "Screen %s   CPU search %.0f knps\n",
+                      samples.empty() ? "-" : samples.back().screen, profiler.searchRate() / 1000.0);
+        text += line;
+
+        // Per-zone cost over the most recent loop iterations.
+        struct ZoneTotal
+        {
+            std::uint64_t totalNs = 0;
+            std::uint64_t maxNs = 0;
+            int depth = 0;
+        };
+        std::map<std::string_view, ZoneTotal> zones;
+        const std::uint32_t lastFrame = samples.empty() ? 0 : samples.back().frame;
+        const std::uint32_t firstFrame = lastFrame > ZONE_WINDOW_FRAMES ? lastFrame - ZONE_WINDOW_FRAMES : 0;
+        std::uint32_t oldestFrame = lastFrame;
+        for (const ProfileSample &sample : samples)
+        {
+            if (sample.frame <= firstFrame || sample.depth == 0)
+                continue;
+            oldestFrame = std::min(oldestFrame, sample.frame);
+            ZoneTotal &zone = zones[sample.zone];
+            zone.totalNs += sample.durationNs;
+            zone.maxNs = std::max(zone.maxNs, sample.durationNs);
+            zone.depth = sample.depth;
+        }
+        const double frames = static_cast<double>(lastFrame - oldestFrame + 1);
+
+        std::vector<std::pair<std::string_view, ZoneTotal>> sorted(zones.begin(), zones.end());
+        std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b)
+                  { return a.second.totalNs > b.second.totalNs; });
+        text += "Zone                         avg ms   max ms";
+        for (std::size_t i = 0; i < std::min(sorted.size(), MAX_ZONE_LINES); ++i)
+        {
+            const std::string name = std::string(static_cast<std::size_t>(2 * (sorted[i].second.depth - 1)), ' ') +
+                                     std::string(sorted[i].first);
+            std::snprintf(line, sizeof(line), "\n%-28.28s %7.3f  %7.3f", name.c_str(),
+                          sorted[i].second.totalNs / frames / 1e6, sorted[i].second.maxNs / 1e6);
+            text += line;
+        }
+        m_text.setString(text);
+
+        const float textBottom = m_hasFont ? m_text.getGlobalBounds().position.y + m_text.getGlobalBounds().size.y
+                                           : PANEL_ORIGIN.y + PANEL_PADDING;
+        const float baseY = textBottom + PANEL_PADDING + HISTOGRAM_HEIGHT;
+        m_panel.setSize({PANEL_WIDTH, baseY + PANEL_PADDING - PANEL_ORIGIN.y});
+
+        // One bar per presented frame, green within the 60 Hz budget, amber within 30 Hz, red beyond.
+        const std::vector<float> times = profiler.frameTimes();
+        const float barWidth = (PANEL_WIDTH - 2.f * PANEL_PADDING) / static_cast<float>(Profiler::FRAME_HISTORY);
+        m_histogram.clear();
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            const float height = std::min(times[i] / HISTOGRAM_FULL_SCALE_MS, 1.f) * HISTOGRAM_HEIGHT;
+            const float left = PANEL_ORIGIN.x + PANEL_PADDING + static_cast<float>(i) * barWidth;
+            const sf::Color color = times[i] <= FRAME_BUDGET_MS       ? sf::Color(80, 200, 80)
+                                    : times[i] <= 2.f * FRAME_BUDGET_MS ? sf::Color(230, 180, 60)
+                                                                        : sf::Color(220, 70, 70);
+            const sf::Vector2f topLeft = {left, baseY - height};
+            const sf::Vector2f topRight = {left + barWidth, baseY - height};
+            const sf::Vector2f bottomLeft = {left, baseY};
+            const sf::Vector2f bottomRight = {left + barWidth, baseY};
+            for (const sf::Vector2f &corner : {topLeft, topRight, bottomRight, topLeft, bottomRight, bottomLeft})
+            {
+                sf::Vertex vertex;
+                vertex.position = corner;
+                vertex.color = color;
+                m_histogram.append(vertex);
+            }
+        }
+    }
+
+    // Draw in window pixels so the overlay keeps its size on any screen or view. #
+    void ProfilerOverlay::render(sf::RenderWindow &window)
+    {
+        if (!m_visible)
+            return;
+        if (m_refreshClock.getElapsedTime().asSeconds() >= REFRESH_SECONDS)
+        {
+            refresh();
+            m_refreshClock.restart();
+        }
+
+        const sf::View oldView = window.getView();
+        const sf::Vector2f size(window.getSize());
+        window.setView(sf::View(sf::FloatRect({0.f, 0.f}, size)));
+        window.draw(m_panel);
+        window.draw(m_histogram);
+        if (m_hasFont)
+            window.draw(m_text);
+        window.setView(oldView);
+    }
+}
@@ -0,0 +1,107 @@
+#include "ui/ResourceCache.hpp"
+#include "ui/AssetLoader.hpp"
+
+namespace UI
+{
+    // Access the singleton instance shared by every screen and entity. #
+    ResourceCache &ResourceCache::instance()
+    {
+        static ResourceCache cache;
+        return cache;
+    }
+
+    // Return the cached entry for a path, loading it on first use. #
+    template <typename T, typename Loader>
+    ResourceHandle<T> ResourceCache::acquire(std::unordered_map<std::string, ResourceHandle<T>> &entries,
+                                             const std::string &path, Loader load)
+    {
+        const auto found = entries.find(path);
+        if (found != entries.end())
+            return found->second;
+
+        // Callers report the failure with their own context.
+        auto resource = std::make_shared<T>();
+        if (!load(*resource, path))
+            resource.reset();
+        entries.emplace(path, resource);
+        return resource;
+    }
+
+    // Load or reuse a texture, uploading already decoded pixels when the image is cached. #
+    ResourceHandle<sf::Texture> ResourceCache::texture(const std::string &path)
+    {
+        return acquire(m_textures, path, [this](sf::Texture &texture, const std::string &file)
+                       {
+                           const auto decoded = m_images.find(file);
+                           if (decoded != m_images.end() && decoded->second)
+                               return texture.loadFromImage(*decoded->second);
+                           return texture.loadFromFile(file); });
+    }
+
+    // Load or reuse a font. #
+    ResourceHandle<sf::Font> ResourceCache::font(const std::string &path)
+    {
+        return acquire(m_fonts, path, [](sf::Font &font, const std::string &file)
+                       { return font.openFromFile(file); });
+    }
+
+    // Load or reuse a sound buffer, going through the PCM cache rather than decoding each launch. #
+    ResourceHandle<sf::SoundBuffer> ResourceCache::soundBuffer(const std::string &path)
+    {
+        return acquire(m_soundBuffers, path, [](sf::SoundBuffer &buffer, const std::string &file)
+                       {
+                           DecodedSound sound;
+                           return AssetLoader::decodeSound(file, sound) &&
+                                  buffer.loadFromSamples(sound.samples.data(), sound.samples.size(),
+                                                         sound.channelCount, sound.sampleRate, sound.channelMap); });
+    }
+
+    // Load or reuse decoded pixels. #
+    ResourceHandle<sf::Image> ResourceCache::image(const std::string &path)
+    {
+        return acquire(m_images, path, [](sf::Image &image, const std::string &file)
+                       { return image.loadFromFile(file); });
+    }
+
+    // Adopt pixels decoded elsewhere, keeping an entry that is already loaded. #
+    void ResourceCache::store(const std::string &path, ResourceHandle<sf::Image> image)
+    {
+        if (image)
+            m_images.try_emplace(path, std::move(image));
+    }
+
+    // Adopt a sound buffer built elsewhere, keeping an entry that is already loaded. #
+    void ResourceCache::store(const std::string &path, ResourceHandle<sf::SoundBuffer> buffer)
+    {
+        if (buffer)
+            m_soundBuffers.try_emplace(path, std::move(buffer));
+    }
+
+    // Erase loaded entries whose only owner is the cache. #
+    template <typename T>
+    std::size_t ResourceCache::releaseFrom(std::unordered_map<std::string, ResourceHandle<T>> &entries)
+    {
+        return std::erase_if(entries, [](const auto &entry)
+                             { return entry.second && entry.second.use_count() == 1; });
+    }
+
+    // Free every asset no longer held by a screen, entity or sound. #
+    std::size_t ResourceCache::releaseUnused()
+    {
+        return releaseFrom(m_textures) + releaseFrom(m_fonts) + releaseFrom(m_soundBuffers) + releaseFrom(m_images);
+    }
+
+    // Return an empty texture that lives for the whole program. #
+    const sf::Texture &ResourceCache::emptyTexture()
+    {
+        static const sf::Texture texture;
+        return texture;
+    }
+
+    // Return an empty font that lives for the whole program. #
+    const sf::Font &ResourceCache::emptyFont()
+    {
+        static const sf::Font font;
+        return font;
+    }
+}
@@ -3,28 +3,30 @@
 
 namespace UI
 {
-    // Construct sprites bound to textures. #
+    // Construct sprites bound to a placeholder until tiles load. #
     StateComponent::StateComponent()
-        : m_tileSprite(m_tileTexture),
-          m_hoverTileSprite(m_hoverTileTexture)
+        : m_tileSprite(ResourceCache::emptyTexture()),
+          m_hoverTileSprite(ResourceCache::emptyTexture())
     {
     }
 
     // Load base and hover textures and configure sprites. #
     bool StateComponent::initTiles(const std::string &tilePath, const std::string &hoverTilePath)
     {
-        if (!m_tileTexture.loadFromFile(tilePath))
+        m_tileTexture = ResourceCache::instance().texture(tilePath);
+        if (!m_tileTexture)
             return false;
 
         const std::string hoverPath = hoverTilePath.empty() ? tilePath : hoverTilePath;
-        if (!m_hoverTileTexture.loadFromFile(hoverPath))
+        m_hoverTileTexture = ResourceCache::instance().texture(hoverPath);
+        if (!m_hoverTileTexture)
             return false;
 
-        m_tileSprite.setTexture(m_tileTexture, true);
-        m_hoverTileSprite.setTexture(m_hoverTileTexture, true);
+        m_tileSprite.setTexture(*m_tileTexture, true);
+        m_hoverTileSprite.setTexture(*m_hoverTileTexture, true);
 
-        setCenteredOrigin(m_tileSprite, m_tileTexture);
-        setCenteredOrigin(m_hoverTileSprite, m_hoverTileTexture);
+        setCenteredOrigin(m_tileSprite, *m_tileTexture);
+        setCenteredOrigin(m_hoverTileSprite, *m_hoverTileTexture);
 
         if (hoverTilePath.empty())
             m_hoverTileSprite.setColor(sf::Color(255, 255, 255, 210));
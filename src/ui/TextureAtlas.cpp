@@ -0,0 +1,72 @@
+#include "ui/TextureAtlas.hpp"
+#include "ui/ResourceCache.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace UI
+{
+    // Pack images left to right in shelves, then upload the result once. #
+    bool TextureAtlas::build(const std::vector<std::string> &paths)
+    {
+        // Pixels come from the shared cache, so images decoded at startup are not read again.
+        std::vector<ResourceHandle<sf::Image>> images(paths.size());
+        for (std::size_t i = 0; i < paths.size(); ++i)
+        {
+            images[i] = ResourceCache::instance().image(paths[i]);
+            if (!images[i])
+            {
+                std::cerr << "Error: Could not load " << paths[i] << " into the atlas\n";
+                return false;
+            }
+        }
+
+        m_regions.assign(paths.size(), sf::IntRect());
+        unsigned int cursorX = 0;
+        unsigned int shelfY = 0;
+        unsigned int shelfHeight = 0;
+        unsigned int width = 0;
+        for (std::size_t i = 0; i < images.size(); ++i)
+        {
+            const sf::Vector2u size = images[i]->getSize();
+            if (cursorX > 0 && cursorX + size.x > MAX_WIDTH)
+            {
+                cursorX = 0;
+                shelfY += shelfHeight + PADDING;
+                shelfHeight = 0;
+            }
+            m_regions[i] = sf::IntRect({static_cast<int>(cursorX), static_cast<int>(shelfY)},
+                                       {static_cast<int>(size.x), static_cast<int>(size.y)});
+            cursorX += size.x + PADDING;
+            width = std::max(width, cursorX);
+            shelfHeight = std::max(shelfHeight, size.y);
+        }
+
+        sf::Image packed({std::max(1u, width), std::max(1u, shelfY + shelfHeight)}, sf::Color::Transparent);
+        for (std::size_t i = 0; i < images.size(); ++i)
+        {
+            const sf::Vector2u dest(static_cast<unsigned int>(m_regions[i].position.x),
+                                    static_cast<unsigned int>(m_regions[i].position.y));
+            if (!packed.copy(*images[i], dest))
+                return false;
+        }
+
+        if (!m_texture.loadFromImage(packed))
+        {
+            std::cerr << "Error: Could not create texture atlas\n";
+            return false;
+        }
+        return true;
+    }
+
+    // Access the packed texture. #
+    const sf::Texture &TextureAtlas::texture() const
+    {
+        return m_texture;
+    }
+
+    // Access the rect of one packed image. #
+    const sf::IntRect &TextureAtlas::region(std::size_t index) const
+    {
+        return m_regions[index];
+    }
+}
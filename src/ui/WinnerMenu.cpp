@@ -99,7 +99,7 @@ namespace UI
         sf::Vector2f bannerSize = UI::WIN_BANNER_SIZE;
         if (m_hasBackground)
         {
-            const sf::Vector2u texSize = m_backgroundTexture.getSize();
+            const sf::Vector2u texSize = m_backgroundTexture->getSize();
             if (texSize.x > 0 && texSize.y > 0)
             {
                 const float scale = std::min(viewSize.x / UI_DESIGN_SIZE.x,
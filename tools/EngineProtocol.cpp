@@ -0,0 +1,309 @@
+// Headless engine speaking a line protocol on stdin/stdout, for tournament managers and profiling.
+// Commands:
+//   qei                                   -> id lines, option lines, "qeiok"
+//   isready                               -> "readyok"
+//   setoption name <Hash|Contempt|Tablebase> value <v>
+//   newgame
+//   position startpos [players 2|4] [moves <m1> <m2> ...]
+//   position pos <pawns> <walls> <wallsleft> <side> [moves ...]   (same text as quoridor_analyze)
+//   go [depth N] [nodes N] [movetime ms] [clock ms] [inc ms] [infinite]
+//   stop
+//   quit
+// While searching the engine prints "info depth D score S nodes N time T pv <moves>" after each
+// iteration, then "bestmove <move>". "go infinite" runs until stop or a forced result. Until bestmove,
+// commands other than stop, isready and quit are refused with "info string busy <command>".
+// "movetime" is a fixed budget: the search uses all of it unless the result is forced.
+// Moves use the board notation: "e2", "d4h", "c6v".
+#include "game/GameRules.hpp"
+#include "game/Notation.hpp"
+#include "heuristic/HeuristicEngine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr int kInfiniteDepth = 64;
+
+    class EngineSession // Protocol state: position, options and the search thread #
+    {
+    public:
+        EngineSession()
+        {
+            m_config.maxDepth = 4;
+            rebuildEngine();
+            resetPosition(2);
+        }
+
+        ~EngineSession()
+        {
+            stopSearch();
+        }
+
+        // Handle one command line; false on quit. #
+        bool handle(const std::string &line)
+        {
+            std::istringstream in(line);
+            std::string command;
+            if (!(in >> command))
+                return true;
+
+            if (command == "quit")
+            {
+                stopSearch();
+                return false;
+            }
+            if (command == "stop")
+            {
+                stopSearch();
+                return true;
+            }
+            if (command == "isready")
+            {
+                send("readyok");
+                return true;
+            }
+
+            // Everything else changes engine state. Joining a running search here could block forever
+            // ("go infinite"), and the stop line after this one would never be read, so refuse instead.
+            if (m_searching.load())
+            {
+                send("info string busy " + command);
+                return true;
+            }
+            waitForSearch();
+
+            if (command == "qei")
+            {
+                send("id name QuoridorEngine");
+                send("option name Hash type spin default 1048576 min 1 max 67108864");
+                send("option name Contempt type spin default 0");
+                send("option name Tablebase type string default <empty>");
+                send("qeiok");
+            }
+            else if (command == "setoption")
+                setOption(in);
+            else if (command == "newgame")
+                resetPosition(2);
+            else if (command == "position")
+                setPosition(in);
+            else if (command == "go")
+                go(in);
+            else
+                send("info string unknown command " + command);
+            return true;
+        }
+
+    private:
+        // Write one line to stdout (search and input threads share it). #
+        void send(const std::string &line)
+        {
+            std::lock_guard<std::mutex> lock(m_outputMutex);
+            std::cout << line << std::endl;
+        }
+
+        // Create the engine for the current hash size. #
+        void rebuildEngine()
+        {
+            m_engine = std::make_unique<Game::HeuristicEngine>(m_config, m_hashEntries);
+            m_engine->setStopFlag(&m_stop);
+            m_engine->setInfoCallback([this](const Game::HeuristicSearchInfo &info)
+                                      { send(formatInfo(info)); });
+        }
+
+        // Start from the initial position with an empty history. #
+        void resetPosition(int players)
+        {
+            Game::initGameState(m_state, players);
+            m_history.assign(1, Game::computeZobristKeys(m_state));
+        }
+
+        // Parse "setoption name <id> value <v>". #
+        void setOption(std::istringstream &in)
+        {
+            std::string token;
+            std::string name;
+            std::string value;
+            in >> token >> name >> token;
+            std::getline(in >> std::ws, value);
+
+            if (name == "Hash")
+            {
+                m_hashEntries = static_cast<size_t>(std::max(1LL, std::atoll(value.c_str())));
+                rebuildEngine();
+            }
+            else if (name == "Contempt")
+                m_config.contempt = std::atoi(value.c_str());
+            else if (name == "Tablebase")
+                m_config.tablebasePath = (value == "<empty>") ? "" : value;
+            else
+                send("info string unknown option " + name);
+        }
+
+        // Parse "position startpos|pos ... [moves ...]"; the position only changes if every move applies. #
+        void setPosition(std::istringstream &in)
+        {
+            std::string kind;
+            in >> kind;
+            std::string token;
+            Game::GameState state{};
+
+            if (kind == "startpos")
+            {
+                int players = 2;
+                if (in >> token && token == "players")
+                {
+                    in >> players;
+                    token.clear();
+                    in >> token;
+                }
+                Game::initGameState(state, players == 4 ? 4 : 2);
+            }
+            else if (kind == "pos")
+            {
+                std::string fields[4];
+                in >> fields[0] >> fields[1] >> fields[2] >> fields[3];
+                if (!Game::parsePosition(fields[0] + " " + fields[1] + " " + fields[2] + " " + fields[3], state))
+                {
+                    send("info string invalid position");
+                    return;
+                }
+                in >> token;
+            }
+            else
+            {
+                send("info string invalid position");
+                return;
+            }
+
+            std::vector<Game::ZobristKeys> history(1, Game::computeZobristKeys(state));
+            if (token == "moves")
+            {
+                while (in >> token)
+                {
+                    Game::Move move;
+                    if (!Game::parseMove(token, Game::currentPlayer(state), move) || !Game::applyMove(state, move))
+                    {
+                        send("info string illegal move " + token);
+                        return;
+                    }
+                    if (move.type() == Game::MoveType::WallPlacement)
+                        history.clear();
+                    history.push_back(Game::computeZobristKeys(state));
+                }
+            }
+
+            m_state = state;
+            m_history = std::move(history);
+        }
+
+        // Parse limits and start the search thread. #
+        void go(std::istringstream &in)
+        {
+            Game::HeuristicSearchConfig config = m_config;
+            std::string token;
+            while (in >> token)
+            {
+                long long value = 0;
+                if (token == "infinite")
+                {
+                    config.maxDepth = kInfiniteDepth;
+                    config.deterministic = true;
+                    continue;
+                }
+                if (!(in >> value))
+                    break;
+                if (token == "depth")
+                    config.maxDepth = static_cast<int>(std::max(1LL, value));
+                else if (token == "nodes")
+                    config.maxNodes = std::max(0LL, value);
+                else if (token == "movetime")
+                    config.moveTimeMs = static_cast<int>(std::max(1LL, value));
+                else if (token == "clock")
+                    config.clockMs = static_cast<int>(std::max(0LL, value));
+                else if (token == "inc")
+                    config.incrementMs = static_cast<int>(std::max(0LL, value));
+            }
+
+            if (Game::isGameOver(m_state))
+            {
+                send("bestmove none");
+                return;
+            }
+
+            m_engine->setConfig(config);
+            m_stop.store(false);
+            m_searching.store(true);
+            m_searchThread = std::thread([this, state = m_state, history = m_history]()
+                                         {
+                const Game::Move best = m_engine->findBestMove(state, history);
+                // Clear the flag first: a controller may answer bestmove at once, and its next command
+                // must not be refused as busy. handle() then only joins a thread that is about to exit.
+                m_searching.store(false);
+                send("bestmove " + Game::moveToText(best)); });
+        }
+
+        // Ask the search to finish and wait for its bestmove line. #
+        void stopSearch()
+        {
+            m_stop.store(true);
+            waitForSearch();
+        }
+
+        // Reap the search thread; only called once it has finished or been told to stop. #
+        void waitForSearch()
+        {
+            if (m_searchThread.joinable())
+                m_searchThread.join();
+        }
+
+        // Build an info line from iteration statistics. #
+        static std::string formatInfo(const Game::HeuristicSearchInfo &info)
+        {
+            std::ostringstream line;
+            line << "info depth " << info.depth << " score " << info.score << " nodes " << info.nodes
+                 << " time " << info.elapsedMs;
+            if (!info.pv.empty())
+            {
+                line << " pv";
+                for (const Game::Move &move : info.pv)
+                    line << ' ' << Game::moveToText(move);
+            }
+            return line.str();
+        }
+
+        Game::HeuristicSearchConfig m_config;
+        size_t m_hashEntries = 1 << 20;
+        std::unique_ptr<Game::HeuristicEngine> m_engine;
+        Game::GameState m_state{};
+        std::vector<Game::ZobristKeys> m_history;
+        std::atomic<bool> m_stop{false};
+        std::atomic<bool> m_searching{false}; // Set from go until the search returns #
+        std::thread m_searchThread;
+        std::mutex m_outputMutex;
+    };
+}
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+
+    EngineSession session;
+    std::string line;
+    while (std::getline(std::cin, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (!session.handle(line))
+            break;
+    }
+    return 0;
+}
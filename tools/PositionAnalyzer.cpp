@@ -0,0 +1,255 @@
+// Analyze a corpus of positions with the heuristic engine on several threads.
+// Usage: quoridor_analyze [--in <file>] [--out <file>] [--format text|bin] [--threads N]
+//                         [--depth N] [--time ms] [--nodes N] [--deterministic]
+//                         [--hash entries] [--batch N]
+//                         [--tablebase <dir>] [--convert <file.bin>]
+// Reads positions from a file or stdin and writes one result line per position,
+// in input order: "<position>\t<move>\t<score>\t<depth>\t<nodes>\t<ms>".
+#include "game/GameRules.hpp"
+#include "game/Notation.hpp"
+#include "game/PositionRecord.hpp"
+#include "heuristic/HeuristicEngine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        std::string inPath; // Empty reads stdin #
+        std::string outPath; // Empty writes stdout #
+        std::string convertPath; // Write binary records instead of analyzing #
+        bool binaryInput = false;
+        int threads = 0; // 0 uses hardware concurrency #
+        size_t hashEntries = 1 << 16;
+        size_t batchSize = 1024;
+        Game::HeuristicSearchConfig config;
+    };
+
+    struct Job // One position and its result line #
+    {
+        std::string source; // Input text (or re-encoded record) #
+        Game::GameState state{};
+        bool valid = false;
+        std::string result;
+    };
+
+    // Print usage to stderr. #
+    void printUsage(const char *program)
+    {
+        std::cerr << "Usage: " << program
+                  << " [--in <file>] [--out <file>] [--format text|bin] [--threads N]"
+                     " [--depth N] [--time ms] [--nodes N] [--deterministic] [--hash entries] [--batch N]"
+                     " [--tablebase <dir>] [--convert <file.bin>]\n";
+    }
+
+    // Parse command-line flags. #
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        options.config.maxDepth = 3;
+        options.config.timeLimitMs = 1000;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const bool hasValue = i + 1 < argc;
+            if (std::strcmp(argv[i], "--in") == 0 && hasValue)
+                options.inPath = argv[++i];
+            else if (std::strcmp(argv[i], "--out") == 0 && hasValue)
+                options.outPath = argv[++i];
+            else if (std::strcmp(argv[i], "--convert") == 0 && hasValue)
+                options.convertPath = argv[++i];
+            else if (std::strcmp(argv[i], "--format") == 0 && hasValue)
+            {
+                const std::string format = argv[++i];
+                if (format != "text" && format != "bin")
+                    return false;
+                options.binaryInput = (format == "bin");
+            }
+            else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+                options.threads = std::atoi(argv[++i]);
+            else if (std::strcmp(argv[i], "--depth") == 0 && hasValue)
+                options.config.maxDepth = std::max(1, std::atoi(argv[++i]));
+            else if (std::strcmp(argv[i], "--time") == 0 && hasValue)
+                options.config.timeLimitMs = std::max(1, std::atoi(argv[++i]));
+            else if (std::strcmp(argv[i], "--nodes") == 0 && hasValue)
+                options.config.maxNodes = std::max(0LL, std::atoll(argv[++i]));
+            else if (std::strcmp(argv[i], "--deterministic") == 0)
+                options.config.deterministic = true;
+            else if (std::strcmp(argv[i], "--hash") == 0 && hasValue)
+                options.hashEntries = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+            else if (std::strcmp(argv[i], "--batch") == 0 && hasValue)
+                options.batchSize = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+            else if (std::strcmp(argv[i], "--tablebase") == 0 && hasValue)
+                options.config.tablebasePath = argv[++i];
+            else
+                return false;
+        }
+
+        if (options.threads <= 0)
+            options.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        return true;
+    }
+
+    // Read up to batchSize positions; returns false once input is exhausted. #
+    bool readBatch(std::istream &in, const Options &options, std::vector<Job> &batch)
+    {
+        batch.clear();
+        while (batch.size() < options.batchSize)
+        {
+            Job job;
+            if (options.binaryInput)
+            {
+                Game::PositionRecord record;
+                if (!in.read(reinterpret_cast<char *>(record.bytes), Game::PositionRecord::SIZE))
+                    break;
+                job.valid = Game::decodePosition(record, job.state);
+                job.source = job.valid ? Game::positionToText(job.state) : "<invalid record>";
+            }
+            else
+            {
+                std::string line;
+                if (!std::getline(in, line))
+                    break;
+                if (!line.empty() && line.back() == '\r')
+                    line.pop_back();
+                if (line.empty() || line[0] == '#')
+                    continue;
+                job.source = line;
+                job.valid = Game::parsePosition(line, job.state);
+            }
+            batch.push_back(std::move(job));
+        }
+        return !batch.empty();
+    }
+
+    // Search one position and format its result line. #
+    void analyze(Game::HeuristicEngine &engine, Job &job)
+    {
+        std::ostringstream line;
+        line << job.source << '\t';
+        if (!job.valid)
+        {
+            line << "error";
+        }
+        else if (Game::isGameOver(job.state))
+        {
+            line << "-\tgameover";
+        }
+        else
+        {
+            const Game::Move best = engine.findBestMove(job.state);
+            const Game::HeuristicSearchInfo &info = engine.lastSearchInfo();
+            line << Game::moveToText(best) << '\t' << info.score << '\t' << info.depth << '\t'
+                 << info.nodes << '\t' << info.elapsedMs;
+        }
+        job.result = line.str();
+    }
+
+    // Spread a batch over the workers; each worker owns its engine. #
+    void analyzeBatch(std::vector<std::unique_ptr<Game::HeuristicEngine>> &engines, std::vector<Job> &batch)
+    {
+        std::atomic<size_t> next{0};
+        std::vector<std::thread> workers;
+        const size_t count = std::min(engines.size(), batch.size());
+        workers.reserve(count);
+
+        for (size_t w = 0; w < count; ++w)
+        {
+            workers.emplace_back([&, w]()
+                                 {
+                for (size_t i = next.fetch_add(1); i < batch.size(); i = next.fetch_add(1))
+                    analyze(*engines[w], batch[i]); });
+        }
+        for (std::thread &worker : workers)
+            worker.join();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::ifstream inFile;
+    if (!options.inPath.empty())
+    {
+        inFile.open(options.inPath, options.binaryInput ? std::ios::binary : std::ios::in);
+        if (!inFile)
+        {
+            std::cerr << "Cannot open " << options.inPath << "\n";
+            return 1;
+        }
+    }
+    std::istream &in = options.inPath.empty() ? std::cin : inFile;
+
+    // Conversion mode: text positions to fixed-size binary records.
+    if (!options.convertPath.empty())
+    {
+        std::ofstream bin(options.convertPath, std::ios::binary);
+        if (!bin)
+        {
+            std::cerr << "Cannot open " << options.convertPath << "\n";
+            return 1;
+        }
+        std::vector<Job> batch;
+        size_t written = 0;
+        while (readBatch(in, options, batch))
+        {
+            for (const Job &job : batch)
+            {
+                if (!job.valid)
+                {
+                    std::cerr << "Skipping invalid position: " << job.source << "\n";
+                    continue;
+                }
+                Game::PositionRecord record;
+                Game::encodePosition(job.state, record);
+                bin.write(reinterpret_cast<const char *>(record.bytes), Game::PositionRecord::SIZE);
+                ++written;
+            }
+        }
+        std::cerr << written << " records written\n";
+        return 0;
+    }
+
+    std::ofstream outFile;
+    if (!options.outPath.empty())
+    {
+        outFile.open(options.outPath);
+        if (!outFile)
+        {
+            std::cerr << "Cannot open " << options.outPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream &out = options.outPath.empty() ? std::cout : outFile;
+
+    std::vector<std::unique_ptr<Game::HeuristicEngine>> engines;
+    for (int i = 0; i < options.threads; ++i)
+        engines.push_back(std::make_unique<Game::HeuristicEngine>(options.config, options.hashEntries));
+
+    std::vector<Job> batch;
+    while (readBatch(in, options, batch))
+    {
+        analyzeBatch(engines, batch);
+        for (const Job &job : batch)
+            out << job.result << '\n';
+        out.flush();
+    }
+
+    return 0;
+}
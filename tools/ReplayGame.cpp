@@ -0,0 +1,119 @@
+// Re-search every position of a recorded game and compare with what was played.
+// Usage: quoridor_replay <record.qgn> [--depth N] [--nodes N] [--engine-only]
+// The search ignores the clock (fixed depth and optional node budget), so two engine
+// builds can be compared on the same record for speed (nodes, ms) and choices.
+#include "game/GameRecord.hpp"
+#include "game/GameRules.hpp"
+#include "game/Notation.hpp"
+#include "heuristic/HeuristicEngine.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+    std::string path;
+    Game::HeuristicSearchConfig config;
+    config.maxDepth = 4;
+    config.deterministic = true;
+    bool engineOnly = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--depth") == 0 && i + 1 < argc)
+            config.maxDepth = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--nodes") == 0 && i + 1 < argc)
+            config.maxNodes = std::max(0LL, std::atoll(argv[++i]));
+        else if (std::strcmp(argv[i], "--engine-only") == 0)
+            engineOnly = true;
+        else if (argv[i][0] != '-' && path.empty())
+            path = argv[i];
+        else
+        {
+            path.clear();
+            break;
+        }
+    }
+
+    if (path.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " <record.qgn> [--depth N] [--nodes N] [--engine-only]\n";
+        return 2;
+    }
+
+    Game::GameRecord record;
+    if (!record.load(path))
+    {
+        std::cerr << "Cannot read game record " << path << "\n";
+        return 1;
+    }
+
+    Game::HeuristicEngine engine(config);
+    Game::GameState state = record.start();
+    std::vector<Game::ZobristKeys> history(1, Game::computeZobristKeys(state));
+
+    int searched = 0;
+    int agreed = 0;
+    int64_t recordedNodes = 0;
+    int64_t replayNodes = 0;
+    int64_t recordedMs = 0;
+    int64_t replayMs = 0;
+
+    std::cout << "ply  side  played  recorded(score/nodes/ms)      replay  score  nodes  ms\n";
+    for (size_t ply = 0; ply < record.moves().size(); ++ply)
+    {
+        const Game::RecordedMove &played = record.moves()[ply];
+        if (!engineOnly || played.searched)
+        {
+            const Game::Move best = engine.findBestMove(state, history);
+            const Game::HeuristicSearchInfo &info = engine.lastSearchInfo();
+            const std::string playedText = Game::moveToText(played.move);
+            const std::string bestText = Game::moveToText(best);
+
+            std::cout << std::setw(3) << ply + 1 << "  P" << Game::currentPlayer(state) << "    "
+                      << std::setw(6) << playedText << "  ";
+            if (played.searched)
+            {
+                std::cout << std::setw(28) << (std::to_string(played.score) + "/" + std::to_string(played.nodes) +
+                                               "/" + std::to_string(played.timeMs));
+                recordedNodes += played.nodes;
+                recordedMs += played.timeMs;
+            }
+            else
+            {
+                std::cout << std::setw(28) << "-";
+            }
+            std::cout << "  " << std::setw(6) << bestText << "  " << info.score << "  " << info.nodes << "  "
+                      << info.elapsedMs << (bestText == playedText ? "" : "  *") << "\n";
+
+            ++searched;
+            if (bestText == playedText)
+                ++agreed;
+            replayNodes += info.nodes;
+            replayMs += info.elapsedMs;
+        }
+
+        if (!Game::applyMove(state, played.move))
+        {
+            std::cerr << "Illegal move in record at ply " << ply + 1 << "\n";
+            return 1;
+        }
+        if (played.move.type() == Game::MoveType::WallPlacement)
+            history.clear();
+        history.push_back(Game::computeZobristKeys(state));
+    }
+
+    std::cout << "\nsearched " << searched << " positions at depth " << config.maxDepth;
+    if (config.maxNodes > 0)
+        std::cout << " (node budget " << config.maxNodes << ")";
+    std::cout << ", "
+              << agreed << " agree with the record\n";
+    std::cout << "nodes: recorded " << recordedNodes << ", replay " << replayNodes << "\n";
+    std::cout << "time:  recorded " << recordedMs << " ms, replay " << replayMs << " ms\n";
+    return 0;
+}
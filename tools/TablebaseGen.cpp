@@ -0,0 +1,89 @@
+// Generate endgame tables for a wall layout and write them to a directory.
+// Usage: quoridor_tablebase --out <dir> [--walls "3,4h 5,2v ..."]
+#include "game/GameRules.hpp"
+#include "heuristic/EndgameTablebase.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    // Parse "x,yh" / "x,yv" anchors into the state's wall grids. #
+    bool parseWalls(const std::string &text, Game::GameState &state)
+    {
+        std::istringstream in(text);
+        std::string token;
+        while (in >> token)
+        {
+            int x = -1;
+            int y = -1;
+            char ori = 0;
+            if (std::sscanf(token.c_str(), "%d,%d%c", &x, &y, &ori) != 3)
+                return false;
+            if (x < 0 || x >= Game::GameState::WALL_GRID || y < 0 || y >= Game::GameState::WALL_GRID)
+                return false;
+            if (ori == 'h')
+                state.hWalls[x][y] = 1;
+            else if (ori == 'v')
+                state.vWalls[x][y] = 1;
+            else
+                return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string outDir;
+    std::string walls;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            outDir = argv[++i];
+        else if (std::strcmp(argv[i], "--walls") == 0 && i + 1 < argc)
+            walls = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " --out <dir> [--walls \"x,yh x,yv ...\"]\n";
+            return 2;
+        }
+    }
+
+    if (outDir.empty())
+    {
+        std::cerr << "Missing --out directory\n";
+        return 2;
+    }
+
+    Game::GameState state{};
+    Game::initGameState(state);
+    if (!parseWalls(walls, state))
+    {
+        std::cerr << "Invalid --walls list: " << walls << "\n";
+        return 2;
+    }
+
+    Game::EndgameTablebase tablebase;
+    tablebase.setStorageDirectory(outDir);
+
+    const int wallSplits[][2] = {{0, 0}, {1, 0}, {0, 1}};
+    for (const auto &split : wallSplits)
+    {
+        state.wallsRemaining[0] = static_cast<uint8_t>(split[0]);
+        state.wallsRemaining[1] = static_cast<uint8_t>(split[1]);
+
+        const auto start = std::chrono::steady_clock::now();
+        tablebase.prepare(state);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start);
+        std::cout << "walls " << split[0] << "/" << split[1] << ": " << elapsed.count()
+                  << " ms, " << tablebase.tableCount() << " tables cached\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,282 @@
+// Fit the evaluation weights to game outcomes (Texel method).
+// Usage: quoridor_tune <record.qgn | dir | positions.txt>... [--threads N] [--skip N] [--k K]
+//                      [--iterations N] [--out <file>]
+// Inputs are .qgn game records (every position after the first --skip plies, labelled with the
+// final result), directories of records, or text files with "<position>\t<winner seat>" lines.
+// Each position's evaluation terms are computed once. Then the logistic scale K is fitted, and the
+// integer weights are moved one step at a time while the mean squared error between
+// sigmoid(K * eval) and the outcome for the side to move keeps falling.
+#include "game/GameRecord.hpp"
+#include "game/GameRules.hpp"
+#include "game/Notation.hpp"
+#include "heuristic/HeuristicEngine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        std::vector<std::string> inputs;
+        int threads = 0; // 0 uses hardware concurrency #
+        int skipPlies = 4; // Opening plies left out of each record #
+        double k = 0.0; // 0 fits K from the starting weights #
+        int iterations = 100; // Passes of the local search #
+        std::string outPath; // Tournament spec output (empty = stdout only) #
+    };
+
+    struct Sample // Evaluation terms for the side to move and its result #
+    {
+        Game::EvaluationFeatures features;
+        float result = 0.0f; // 1 win, 0 loss for the side to move #
+    };
+
+    // Print usage to stderr. #
+    void printUsage(const char *program)
+    {
+        std::cerr << "Usage: " << program
+                  << " <record.qgn | dir | positions.txt>... [--threads N] [--skip N] [--k K]"
+                     " [--iterations N] [--out <file>]\n";
+    }
+
+    // Parse command-line flags; everything else is an input path. #
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const bool hasValue = i + 1 < argc;
+            if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+                options.threads = std::atoi(argv[++i]);
+            else if (std::strcmp(argv[i], "--skip") == 0 && hasValue)
+                options.skipPlies = std::max(0, std::atoi(argv[++i]));
+            else if (std::strcmp(argv[i], "--k") == 0 && hasValue)
+                options.k = std::atof(argv[++i]);
+            else if (std::strcmp(argv[i], "--iterations") == 0 && hasValue)
+                options.iterations = std::max(1, std::atoi(argv[++i]));
+            else if (std::strcmp(argv[i], "--out") == 0 && hasValue)
+                options.outPath = argv[++i];
+            else if (argv[i][0] == '-')
+                return false;
+            else
+                options.inputs.push_back(argv[i]);
+        }
+
+        if (options.threads <= 0)
+            options.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        return !options.inputs.empty();
+    }
+
+    // Add one labelled position (two-player games only). #
+    void addSample(Game::GameState state, int winnerSeat, std::vector<Sample> &samples)
+    {
+        if (Game::playerCount(state) != 2 || Game::isGameOver(state) || winnerSeat < 1 || winnerSeat > 2)
+            return;
+        Sample sample;
+        sample.features = Game::evaluationFeatures(state, state.currentPlayerId);
+        sample.result = (winnerSeat == state.currentPlayerId) ? 1.0f : 0.0f;
+        samples.push_back(sample);
+    }
+
+    // Replay a finished record and label its positions with the winner. #
+    void loadRecord(const std::string &path, int skipPlies, std::vector<Sample> &samples)
+    {
+        Game::GameRecord record;
+        if (!record.load(path))
+        {
+            std::cerr << "Cannot read game record " << path << "\n";
+            return;
+        }
+
+        Game::GameState end = record.start();
+        for (const Game::RecordedMove &played : record.moves())
+            Game::applyMove(end, played.move);
+        const int winnerSeat = Game::winner(end);
+        if (winnerSeat == 0)
+            return;
+
+        Game::GameState state = record.start();
+        for (size_t ply = 0; ply < record.moves().size(); ++ply)
+        {
+            if (static_cast<int>(ply) >= skipPlies)
+                addSample(state, winnerSeat, samples);
+            Game::applyMove(state, record.moves()[ply].move);
+        }
+    }
+
+    // Read "<position>\t<winner seat>" lines. #
+    void loadPositions(const std::string &path, std::vector<Sample> &samples)
+    {
+        std::ifstream in(path);
+        if (!in)
+        {
+            std::cerr << "Cannot open " << path << "\n";
+            return;
+        }
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            const size_t tab = line.find('\t');
+            if (line.empty() || line[0] == '#' || tab == std::string::npos)
+                continue;
+            Game::GameState state{};
+            if (Game::parsePosition(line.substr(0, tab), state))
+                addSample(state, std::atoi(line.c_str() + tab + 1), samples);
+        }
+    }
+
+    // Load every input: records by extension, directories recursively, position lists otherwise. #
+    void loadInputs(const Options &options, std::vector<Sample> &samples)
+    {
+        for (const std::string &input : options.inputs)
+        {
+            std::error_code ec;
+            if (std::filesystem::is_directory(input, ec))
+            {
+                for (const auto &entry : std::filesystem::recursive_directory_iterator(input, ec))
+                {
+                    if (entry.is_regular_file() && entry.path().extension() == ".qgn")
+                        loadRecord(entry.path().string(), options.skipPlies, samples);
+                }
+            }
+            else if (std::filesystem::path(input).extension() == ".qgn")
+                loadRecord(input, options.skipPlies, samples);
+            else
+                loadPositions(input, samples);
+        }
+    }
+
+    // Mean squared error of sigmoid(K * eval) against the results, split over threads. #
+    double meanSquaredError(const std::vector<Sample> &samples, const Game::HeuristicSearchConfig &config,
+                            double k, int threads)
+    {
+        std::vector<double> partial(threads, 0.0);
+        std::vector<std::thread> workers;
+        const size_t chunk = (samples.size() + threads - 1) / threads;
+
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]()
+                                 {
+                const size_t begin = std::min(samples.size(), t * chunk);
+                const size_t end = std::min(samples.size(), begin + chunk);
+                double sum = 0.0;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const double eval = Game::weightedEvaluation(samples[i].features, config);
+                    const double predicted = 1.0 / (1.0 + std::exp(-k * eval));
+                    const double error = samples[i].result - predicted;
+                    sum += error * error;
+                }
+                partial[t] = sum; });
+        }
+        for (std::thread &worker : workers)
+            worker.join();
+
+        double total = 0.0;
+        for (double sum : partial)
+            total += sum;
+        return total / static_cast<double>(samples.size());
+    }
+
+    // Golden-section search for the K that best fits the current weights. #
+    double fitScale(const std::vector<Sample> &samples, const Game::HeuristicSearchConfig &config, int threads)
+    {
+        const double ratio = (std::sqrt(5.0) - 1.0) / 2.0;
+        double lo = std::log(1e-4);
+        double hi = std::log(10.0);
+        for (int i = 0; i < 60; ++i)
+        {
+            const double a = hi - ratio * (hi - lo);
+            const double b = lo + ratio * (hi - lo);
+            if (meanSquaredError(samples, config, std::exp(a), threads) <
+                meanSquaredError(samples, config, std::exp(b), threads))
+                hi = b;
+            else
+                lo = a;
+        }
+        return std::exp((lo + hi) / 2.0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::vector<Sample> samples;
+    loadInputs(options, samples);
+    if (samples.empty())
+    {
+        std::cerr << "No labelled two-player positions found\n";
+        return 1;
+    }
+
+    Game::HeuristicSearchConfig config;
+    const double k = options.k > 0.0 ? options.k : fitScale(samples, config, options.threads);
+    double bestError = meanSquaredError(samples, config, k, options.threads);
+    std::cerr << samples.size() << " positions, K " << k << ", starting error " << std::setprecision(6)
+              << bestError << "\n";
+
+    // Local search: move each weight by one while the error improves.
+    int *weights[] = {&config.weightDistance, &config.weightWalls, &config.weightWidth};
+    for (int pass = 0; pass < options.iterations; ++pass)
+    {
+        bool improved = false;
+        for (int *weight : weights)
+        {
+            for (int step : {1, -1})
+            {
+                *weight += step;
+                const double error = meanSquaredError(samples, config, k, options.threads);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    improved = true;
+                    break;
+                }
+                *weight -= step;
+            }
+        }
+        std::cerr << "pass " << pass + 1 << ": error " << bestError << "  wd " << config.weightDistance
+                  << " ww " << config.weightWalls << " wwidth " << config.weightWidth << "\n";
+        if (!improved)
+            break;
+    }
+
+    const std::string spec = "wd=" + std::to_string(config.weightDistance) + ",ww=" +
+                             std::to_string(config.weightWalls) + ",wwidth=" + std::to_string(config.weightWidth);
+    std::cout << "// Tuned on " << samples.size() << " positions (error " << bestError << ")\n"
+              << "Game::HeuristicSearchConfig config;\n"
+              << "config.weightDistance = " << config.weightDistance << ";\n"
+              << "config.weightWalls = " << config.weightWalls << ";\n"
+              << "config.weightWidth = " << config.weightWidth << ";\n"
+              << "// quoridor_tournament --a " << spec << "\n";
+
+    if (!options.outPath.empty())
+    {
+        std::ofstream out(options.outPath);
+        if (!out)
+        {
+            std::cerr << "Cannot write " << options.outPath << "\n";
+            return 1;
+        }
+        out << spec << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,447 @@
+// Play engine configuration A against B on all cores and stop early with a sequential test.
+// Usage: quoridor_tournament [--a spec] [--b spec] [--games N] [--threads N] [--openings <file>]
+//                            [--opening-plies N] [--seed N] [--max-plies N]
+//                            [--elo0 E] [--elo1 E] [--alpha P] [--beta P] [--save <dir>]
+// A spec is a comma-separated list of key=value: depth, nodes, time (per-move ms, enables the clock),
+// clock, inc, wd, ww, wwidth (evaluation weights), contempt. Without time/clock games are
+// deterministic (fixed depth and node budget).
+// Every opening is played twice with the seats swapped. The SPRT runs on game pairs
+// (pentanomial results), which cancels most of the opening bias. --save writes every game as a
+// .qgn record (a corpus for quoridor_tune).
+#include "game/GameRecord.hpp"
+#include "game/GameRules.hpp"
+#include "game/Notation.hpp"
+#include "heuristic/HeuristicEngine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        Game::HeuristicSearchConfig configA;
+        Game::HeuristicSearchConfig configB;
+        int games = 1000; // Upper bound; the SPRT usually stops earlier #
+        int threads = 0; // 0 uses hardware concurrency #
+        std::string openingsPath;
+        int openingPlies = 4;
+        unsigned seed = 1;
+        int maxPlies = 200; // Longer games count as draws #
+        double elo0 = 0.0;
+        double elo1 = 5.0;
+        double alpha = 0.05;
+        double beta = 0.05;
+        std::string saveDirectory; // Empty keeps no records #
+    };
+
+    struct Tally // Results from A's point of view #
+    {
+        int wins = 0;
+        int draws = 0;
+        int losses = 0;
+        int pairs[5] = {}; // Pair scores 0, 0.5, 1, 1.5, 2 #
+    };
+
+    // Print usage to stderr. #
+    void printUsage(const char *program)
+    {
+        std::cerr << "Usage: " << program
+                  << " [--a spec] [--b spec] [--games N] [--threads N] [--openings <file>]"
+                     " [--opening-plies N] [--seed N] [--max-plies N]"
+                     " [--elo0 E] [--elo1 E] [--alpha P] [--beta P] [--save <dir>]\n"
+                     "  spec: key=value list of depth, nodes, time, clock, inc, wd, ww, wwidth, contempt\n";
+    }
+
+    // Apply a "key=value,..." engine spec to a config. #
+    bool parseSpec(const std::string &spec, Game::HeuristicSearchConfig &config)
+    {
+        std::istringstream in(spec);
+        std::string item;
+        while (std::getline(in, item, ','))
+        {
+            const size_t eq = item.find('=');
+            if (eq == std::string::npos)
+                return false;
+            const std::string key = item.substr(0, eq);
+            const int value = std::atoi(item.c_str() + eq + 1);
+
+            if (key == "depth")
+                config.maxDepth = std::max(1, value);
+            else if (key == "nodes")
+                config.maxNodes = std::max(0, value);
+            else if (key == "time")
+            {
+                config.timeLimitMs = std::max(1, value);
+                config.deterministic = false;
+            }
+            else if (key == "clock")
+            {
+                config.clockMs = std::max(1, value);
+                config.deterministic = false;
+            }
+            else if (key == "inc")
+                config.incrementMs = std::max(0, value);
+            else if (key == "wd")
+                config.weightDistance = value;
+            else if (key == "ww")
+                config.weightWalls = value;
+            else if (key == "wwidth")
+                config.weightWidth = value;
+            else if (key == "contempt")
+                config.contempt = value;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    // Parse command-line flags. #
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        for (Game::HeuristicSearchConfig *config : {&options.configA, &options.configB})
+        {
+            config->maxDepth = 3;
+            config->deterministic = true;
+        }
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const bool hasValue = i + 1 < argc;
+            if (!hasValue)
+                return false;
+            const char *value = argv[++i];
+            const char *flag = argv[i - 1];
+
+            if (std::strcmp(flag, "--a") == 0)
+            {
+                if (!parseSpec(value, options.configA))
+                    return false;
+            }
+            else if (std::strcmp(flag, "--b") == 0)
+            {
+                if (!parseSpec(value, options.configB))
+                    return false;
+            }
+            else if (std::strcmp(flag, "--games") == 0)
+                options.games = std::max(2, std::atoi(value));
+            else if (std::strcmp(flag, "--threads") == 0)
+                options.threads = std::atoi(value);
+            else if (std::strcmp(flag, "--openings") == 0)
+                options.openingsPath = value;
+            else if (std::strcmp(flag, "--opening-plies") == 0)
+                options.openingPlies = std::max(0, std::atoi(value));
+            else if (std::strcmp(flag, "--seed") == 0)
+                options.seed = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+            else if (std::strcmp(flag, "--max-plies") == 0)
+                options.maxPlies = std::max(1, std::atoi(value));
+            else if (std::strcmp(flag, "--elo0") == 0)
+                options.elo0 = std::atof(value);
+            else if (std::strcmp(flag, "--elo1") == 0)
+                options.elo1 = std::atof(value);
+            else if (std::strcmp(flag, "--alpha") == 0)
+                options.alpha = std::atof(value);
+            else if (std::strcmp(flag, "--beta") == 0)
+                options.beta = std::atof(value);
+            else if (std::strcmp(flag, "--save") == 0)
+                options.saveDirectory = value;
+            else
+                return false;
+        }
+
+        if (options.threads <= 0)
+            options.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        return options.alpha > 0.0 && options.alpha < 1.0 && options.beta > 0.0 && options.beta < 1.0;
+    }
+
+    // Load start positions, one per line (comments start with '#'). #
+    bool loadOpenings(const std::string &path, std::vector<Game::GameState> &openings)
+    {
+        std::ifstream in(path);
+        if (!in)
+            return false;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (line.empty() || line[0] == '#')
+                continue;
+            Game::GameState state{};
+            if (Game::parsePosition(line, state) && !Game::isGameOver(state))
+                openings.push_back(state);
+            else
+                std::cerr << "Skipping opening: " << line << "\n";
+        }
+        return !openings.empty();
+    }
+
+    // Build a random opening: mostly pawn moves, with the odd legal wall. #
+    Game::GameState randomOpening(int plies, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        Game::GameState state{};
+        Game::initGameState(state);
+
+        for (int ply = 0; ply < plies && !Game::isGameOver(state); ++ply)
+        {
+            Game::MoveList moves;
+            if (rng() % 4 != 0)
+                Game::generatePawnMoves(state, moves);
+            else
+                Game::generateWallMoves(state, moves);
+
+            // Walls from the generator are only locally legal; retry until one keeps every path open.
+            for (int attempt = 0; attempt < 16 && !moves.empty(); ++attempt)
+            {
+                if (Game::applyMove(state, moves[static_cast<int>(rng() % moves.size)]))
+                    break;
+            }
+        }
+
+        if (Game::isGameOver(state))
+            Game::initGameState(state);
+        return state;
+    }
+
+    // Play one game and log it in record; returns A's score (1, 0.5 or 0). #
+    double playGame(const Game::GameState &opening, bool aMovesFirst, Game::HeuristicEngine &engineA,
+                    Game::HeuristicEngine &engineB, const Options &options, Game::GameRecord &record)
+    {
+        Game::GameState state = opening;
+        const int aSeat = aMovesFirst ? state.currentPlayerId : Game::nextPlayer(state, state.currentPlayerId);
+        std::vector<Game::ZobristKeys> history(1, Game::computeZobristKeys(state));
+
+        record.reset(opening);
+        record.setTag("Event", "Tournament");
+        record.setTag("Player1", aSeat == 1 ? "A" : "B");
+        record.setTag("Player2", aSeat == 2 ? "A" : "B");
+
+        // Each side has its own clock when its spec sets one.
+        int clocks[2] = {options.configA.clockMs, options.configB.clockMs};
+
+        for (int ply = 0; ply < options.maxPlies && !Game::isGameOver(state); ++ply)
+        {
+            const bool aToMove = (state.currentPlayerId == aSeat);
+            Game::HeuristicEngine &engine = aToMove ? engineA : engineB;
+            int &clock = clocks[aToMove ? 0 : 1];
+
+            if (clock > 0)
+            {
+                Game::HeuristicSearchConfig config = engine.config();
+                config.clockMs = clock;
+                engine.setConfig(config);
+            }
+
+            const Game::Move move = engine.findBestMove(state, history);
+            if (clock > 0)
+                clock = std::max(1, clock - engine.lastSearchInfo().elapsedMs) + engine.config().incrementMs;
+
+            // An illegal move loses on the spot.
+            if (!Game::applyMove(state, move))
+                return aToMove ? 0.0 : 1.0;
+
+            const Game::HeuristicSearchInfo &info = engine.lastSearchInfo();
+            Game::RecordedMove played;
+            played.move = move;
+            played.searched = true;
+            played.score = info.score;
+            played.depth = info.depth;
+            played.nodes = info.nodes;
+            played.timeMs = info.elapsedMs;
+            record.addMove(played);
+
+            if (move.type() == Game::MoveType::WallPlacement)
+                history.clear();
+            history.push_back(Game::computeZobristKeys(state));
+        }
+
+        if (!Game::isGameOver(state))
+            return 0.5;
+        return Game::winner(state) == aSeat ? 1.0 : 0.0;
+    }
+
+    // Expected score for an Elo difference. #
+    double scoreFromElo(double elo)
+    {
+        return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+    }
+
+    // Elo difference for an expected score. #
+    double eloFromScore(double score)
+    {
+        score = std::clamp(score, 1e-6, 1.0 - 1e-6);
+        return -400.0 * std::log10(1.0 / score - 1.0);
+    }
+
+    // Mean and variance of the per-pair score (pair points / 2). #
+    void pairStatistics(const Tally &tally, int &pairs, double &mean, double &variance)
+    {
+        pairs = 0;
+        double sum = 0.0;
+        for (int i = 0; i < 5; ++i)
+        {
+            pairs += tally.pairs[i];
+            sum += tally.pairs[i] * (i / 4.0);
+        }
+        mean = pairs > 0 ? sum / pairs : 0.5;
+
+        variance = 0.0;
+        for (int i = 0; i < 5; ++i)
+            variance += tally.pairs[i] * (i / 4.0 - mean) * (i / 4.0 - mean);
+        variance = pairs > 0 ? variance / pairs : 0.0;
+    }
+
+    // Log-likelihood ratio of elo1 against elo0 (normal approximation on pair scores). #
+    double computeLLR(const Tally &tally, const Options &options)
+    {
+        int pairs = 0;
+        double mean = 0.0;
+        double variance = 0.0;
+        pairStatistics(tally, pairs, mean, variance);
+        if (pairs < 2 || variance <= 0.0)
+            return 0.0;
+
+        const double s0 = scoreFromElo(options.elo0);
+        const double s1 = scoreFromElo(options.elo1);
+        return pairs * (s1 - s0) * (2.0 * mean - s0 - s1) / (2.0 * variance);
+    }
+
+    // Print W/D/L, Elo with a 95% interval, and the SPRT state. #
+    void printReport(std::ostream &out, const Tally &tally, const Options &options, double llr,
+                     double lowerBound, double upperBound)
+    {
+        int pairs = 0;
+        double mean = 0.0;
+        double variance = 0.0;
+        pairStatistics(tally, pairs, mean, variance);
+        const double margin = pairs > 0 ? 1.96 * std::sqrt(variance / pairs) : 0.5;
+        const double elo = eloFromScore(mean);
+        const int games = tally.wins + tally.draws + tally.losses;
+
+        out << std::fixed << std::setprecision(1);
+        out << "Games " << games << " (A: W " << tally.wins << " D " << tally.draws << " L " << tally.losses
+            << "), score " << 100.0 * mean << "%\n";
+        out << "Pairs [0, 0.5, 1, 1.5, 2]: [" << tally.pairs[0] << ", " << tally.pairs[1] << ", "
+            << tally.pairs[2] << ", " << tally.pairs[3] << ", " << tally.pairs[4] << "]\n";
+        out << "Elo " << elo << " [" << eloFromScore(mean - margin) << ", " << eloFromScore(mean + margin)
+            << "] (95%)\n";
+        out << std::setprecision(2) << "SPRT [" << options.elo0 << ", " << options.elo1 << "]: LLR " << llr
+            << " (" << lowerBound << ", " << upperBound << ")";
+        if (llr >= upperBound)
+            out << " H1 accepted: A is stronger\n";
+        else if (llr <= lowerBound)
+            out << " H0 accepted: A is not stronger\n";
+        else
+            out << " inconclusive\n";
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::vector<Game::GameState> openings;
+    if (!options.openingsPath.empty() && !loadOpenings(options.openingsPath, openings))
+    {
+        std::cerr << "Cannot read openings from " << options.openingsPath << "\n";
+        return 1;
+    }
+
+    if (!options.saveDirectory.empty())
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(options.saveDirectory, ec);
+    }
+
+    const double lowerBound = std::log(options.beta / (1.0 - options.alpha));
+    const double upperBound = std::log((1.0 - options.beta) / options.alpha);
+    const int totalPairs = (options.games + 1) / 2;
+
+    Tally tally;
+    double llr = 0.0;
+    std::mutex tallyMutex;
+    std::atomic<int> nextPair{0};
+    std::atomic<bool> finished{false};
+
+    auto worker = [&]()
+    {
+        // Small tables: games are short searches and every worker owns its engines.
+        Game::HeuristicEngine engineA(options.configA, 1 << 16);
+        Game::HeuristicEngine engineB(options.configB, 1 << 16);
+
+        for (int pair = nextPair.fetch_add(1); pair < totalPairs && !finished.load(); pair = nextPair.fetch_add(1))
+        {
+            const Game::GameState opening = openings.empty()
+                                                ? randomOpening(options.openingPlies, options.seed + pair)
+                                                : openings[pair % openings.size()];
+            double scores[2] = {};
+            for (int game = 0; game < 2; ++game)
+            {
+                engineA.setConfig(options.configA);
+                engineB.setConfig(options.configB);
+                Game::GameRecord record;
+                scores[game] = playGame(opening, game == 0, engineA, engineB, options, record);
+                record.setTag("Round", std::to_string(pair + 1) + "." + std::to_string(game + 1));
+
+                if (!options.saveDirectory.empty())
+                {
+                    const std::string name = "pair-" + std::to_string(pair + 1) + "-" + std::to_string(game + 1) + ".qgn";
+                    if (!record.save((std::filesystem::path(options.saveDirectory) / name).string()))
+                        std::cerr << "\nCannot write " << name << "\n";
+                }
+            }
+            const double first = scores[0];
+            const double second = scores[1];
+
+            std::lock_guard<std::mutex> lock(tallyMutex);
+            for (double score : {first, second})
+            {
+                if (score > 0.75)
+                    ++tally.wins;
+                else if (score < 0.25)
+                    ++tally.losses;
+                else
+                    ++tally.draws;
+            }
+            ++tally.pairs[static_cast<int>(std::lround((first + second) * 2.0))];
+
+            llr = computeLLR(tally, options);
+            const int games = tally.wins + tally.draws + tally.losses;
+            std::cerr << "\rgames " << games << "  W " << tally.wins << " D " << tally.draws << " L "
+                      << tally.losses << "  LLR " << std::fixed << std::setprecision(2) << llr << "   "
+                      << std::flush;
+            if (llr >= upperBound || llr <= lowerBound)
+                finished.store(true);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < options.threads; ++i)
+        workers.emplace_back(worker);
+    for (std::thread &thread : workers)
+        thread.join();
+    std::cerr << "\n";
+
+    printReport(std::cout, tally, options, llr, lowerBound, upperBound);
+    return 0;
+}